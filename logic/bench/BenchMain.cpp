@@ -0,0 +1,513 @@
+#include "BenchmarkRunner.h"
+#include "logic/AabbBatch.h"
+#include "logic/HeadlessFactory.h"
+#include "logic/MapGenerator.h"
+#include "logic/World.h"
+#include "logic/Score.h"
+#include "logic/VisibilityIndex.h"
+#include "logic/entities/Ghost.h"
+#include "logic/utils/Random.h"
+#include <algorithm>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace pacman;
+using namespace pacman::bench;
+
+namespace {
+
+constexpr float FRAME_TIME = 1.0f / 60.0f;
+constexpr std::size_t POSITION_POOL = 1024;
+
+/**
+ * @brief Ghost die getBestDirectionToTarget publiek maakt (enkel voor benchmark)
+ */
+class ProbeGhost : public Ghost {
+public:
+    ProbeGhost(World& world, const Position& pos) : Ghost(world, pos, GhostColor::RED, 0.0f) {}
+    using Ghost::getBestDirectionToTarget;
+
+protected:
+    Direction chooseDirection() override { return getCurrentDirection(); }
+};
+
+/**
+ * @brief Laadt een level in een World (map file of gegenereerde map data)
+ */
+using MapLoader = std::function<void(World&)>;
+
+/**
+ * @brief Headless World + factory (arena en factory moeten World outliven)
+ *
+ * Zoals LevelState: entities uit een LevelArena, tenzij useArena = false (heap).
+ * storage = COMPONENTS: walls, coins en fruits enkel als component arrays.
+ */
+struct LoadedWorld {
+    LevelArena arena;
+    HeadlessFactory factory;
+    std::unique_ptr<World> world;
+
+    explicit LoadedWorld(const MapLoader& loader, bool load = true, bool useArena = true,
+                         EntityStorage storage = EntityStorage::OBJECTS) {
+        if (useArena) {
+            factory.setArena(&arena);
+        }
+        world = std::make_unique<World>(factory, nullptr);
+        world->setEntityStorage(storage);
+        if (load) {
+            loader(*world);
+        }
+    }
+};
+
+/**
+ * @brief Deterministische posities verspreid over de hele map
+ */
+std::vector<Position> randomPositions(const World& world, std::size_t count) {
+    auto dims = world.getMapDimensions();
+    float worldWidth = static_cast<float>(dims.cols) / static_cast<float>(dims.rows);
+
+    std::vector<Position> positions;
+    positions.reserve(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        positions.emplace_back(Random::getInstance().getFloat(-worldWidth, worldWidth),
+                               Random::getInstance().getFloat(-1.0f, 1.0f));
+    }
+    return positions;
+}
+
+float tileSizeOf(const World& world) {
+    return 2.0f / static_cast<float>(world.getMapDimensions().rows);
+}
+
+std::vector<std::filesystem::path> findMaps(const std::string& mapsDir) {
+    std::vector<std::filesystem::path> maps;
+    for (const auto& entry : std::filesystem::directory_iterator(mapsDir)) {
+        if (entry.is_regular_file() && entry.path().extension() == ".txt") {
+            maps.push_back(entry.path());
+        }
+    }
+    std::sort(maps.begin(), maps.end());
+    return maps;
+}
+
+/**
+ * @brief Parse "32,64,128" naar map groottes
+ */
+std::vector<int> parseSizes(const std::string& list) {
+    std::vector<int> sizes;
+    std::stringstream ss(list);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) {
+            sizes.push_back(std::stoi(item));
+        }
+    }
+    return sizes;
+}
+
+void registerMapBenchmarks(BenchmarkRunner& runner, const MapLoader& loader, const std::string& mapName,
+                           unsigned int seed) {
+    // World::parseMap + spawnEntities (via loadLevel), World constructie niet getimed
+    runner.add({"world/loadLevel/" + mapName, 1, [loader, seed]() -> std::function<void()> {
+        Random::getInstance().seed(seed);
+        auto state = std::make_shared<LoadedWorld>(loader, false);
+        return [state, loader]() { loader(*state->world); };
+    }});
+
+    // Zelfde, entities op de heap (één allocatie per model) i.p.v. de LevelArena
+    runner.add({"world/loadLevel/heap/" + mapName, 1, [loader, seed]() -> std::function<void()> {
+        Random::getInstance().seed(seed);
+        auto state = std::make_shared<LoadedWorld>(loader, false, false);
+        return [state, loader]() { loader(*state->world); };
+    }});
+
+    // Walls, coins en fruits enkel als component arrays (geen Models)
+    runner.add({"world/loadLevel/components/" + mapName, 1, [loader, seed]() -> std::function<void()> {
+        Random::getInstance().seed(seed);
+        auto state = std::make_shared<LoadedWorld>(loader, false, true, EntityStorage::COMPONENTS);
+        return [state, loader]() { loader(*state->world); };
+    }});
+
+    // Level einde: alle entities destroyen + geheugen vrijgeven
+    for (bool useArena : {true, false}) {
+        std::string variant = useArena ? "arena/" : "heap/";
+        runner.add({"world/unloadLevel/" + variant + mapName, 1, [loader, seed, useArena]() -> std::function<void()> {
+            Random::getInstance().seed(seed);
+            auto state = std::make_shared<LoadedWorld>(loader, true, useArena);
+            return [state]() {
+                state->world.reset();
+                state->arena.release();
+            };
+        }});
+    }
+
+    // Volledige tick: PacMan + ghosts + collisions, 10s gesimuleerde gameplay per sample
+    runner.add({"world/update/" + mapName, 600, [loader, seed]() -> std::function<void()> {
+        Random::getInstance().seed(seed);
+        auto state = std::make_shared<LoadedWorld>(loader);
+        if (auto* pacman = state->world->getPacMan()) {
+            pacman->setDirection(Direction::LEFT);
+        }
+        return [state]() { state->world->update(FRAME_TIME); };
+    }});
+
+    // Zelfde tick met de spatial hash geforceerd (elke tick herbouwd), voor de drempel
+    runner.add({"world/update/spatialhash/" + mapName, 600, [loader, seed]() -> std::function<void()> {
+        Random::getInstance().seed(seed);
+        auto state = std::make_shared<LoadedWorld>(loader);
+        state->world->setSpatialHashMinGhosts(0);
+        if (auto* pacman = state->world->getPacMan()) {
+            pacman->setDirection(Direction::LEFT);
+        }
+        return [state]() { state->world->update(FRAME_TIME); };
+    }});
+
+    runner.add({"world/update/components/" + mapName, 600, [loader, seed]() -> std::function<void()> {
+        Random::getInstance().seed(seed);
+        auto state = std::make_shared<LoadedWorld>(loader, true, true, EntityStorage::COMPONENTS);
+        if (auto* pacman = state->world->getPacMan()) {
+            pacman->setDirection(Direction::LEFT);
+        }
+        return [state]() { state->world->update(FRAME_TIME); };
+    }});
+
+    runner.add({"collision/wouldCollideWithWall/" + mapName, 10000, [loader, seed]() -> std::function<void()> {
+        Random::getInstance().seed(seed);
+        auto state = std::make_shared<LoadedWorld>(loader);
+        auto positions = std::make_shared<std::vector<Position>>(randomPositions(*state->world, POSITION_POOL));
+        float radius = tileSizeOf(*state->world) * 0.45f;
+        auto index = std::make_shared<std::size_t>(0);
+
+        return [state, positions, radius, index]() {
+            const Position& pos = (*positions)[(*index)++ % positions->size()];
+            bool hit = state->world->wouldCollideWithWall(pos, radius);
+            doNotOptimize(hit);
+        };
+    }});
+
+    runner.add({"collision/canMoveInDirection/" + mapName, 10000, [loader, seed]() -> std::function<void()> {
+        Random::getInstance().seed(seed);
+        auto state = std::make_shared<LoadedWorld>(loader);
+        auto positions = std::make_shared<std::vector<Position>>(randomPositions(*state->world, POSITION_POOL));
+        float radius = tileSizeOf(*state->world) * 0.4555f;
+        auto index = std::make_shared<std::size_t>(0);
+
+        return [state, positions, radius, index]() {
+            std::size_t i = (*index)++;
+            const Position& pos = (*positions)[i % positions->size()];
+            auto dir = static_cast<Direction>(1 + i % 4);  // UP, DOWN, LEFT, RIGHT
+            bool canMove = state->world->canMoveInDirection(pos, dir, radius);
+            doNotOptimize(canMove);
+        };
+    }});
+
+    // Swept movement over 2 tiles (grote deltaTime)
+    runner.add({"collision/sweepWalls/" + mapName, 10000, [loader, seed]() -> std::function<void()> {
+        Random::getInstance().seed(seed);
+        auto state = std::make_shared<LoadedWorld>(loader);
+        auto positions = std::make_shared<std::vector<Position>>(randomPositions(*state->world, POSITION_POOL));
+        float radius = tileSizeOf(*state->world) * 0.4555f;
+        float distance = tileSizeOf(*state->world) * 2.0f;
+        auto index = std::make_shared<std::size_t>(0);
+
+        return [state, positions, radius, distance, index]() {
+            std::size_t i = (*index)++;
+            const Position& pos = (*positions)[i % positions->size()];
+            auto dir = static_cast<Direction>(1 + i % 4);
+            float travel = state->world->sweepWalls(pos, radius, dir, distance);
+            doNotOptimize(travel);
+        };
+    }});
+
+    // PacMan box tegen alle coins: vroegere lineaire loop (virtual getBoundingBox) vs AabbBatch kernels
+    runner.add({"broadphase/linear/" + mapName, 1000, [loader, seed]() -> std::function<void()> {
+        Random::getInstance().seed(seed);
+        auto state = std::make_shared<LoadedWorld>(loader);
+        auto positions = std::make_shared<std::vector<Position>>(randomPositions(*state->world, POSITION_POOL));
+        float radius = tileSizeOf(*state->world) * 0.4555f;
+        auto index = std::make_shared<std::size_t>(0);
+
+        return [state, positions, radius, index]() {
+            const Position& pos = (*positions)[(*index)++ % positions->size()];
+            BoundingBox box(pos.x - radius, pos.y - radius, radius * 2.0f, radius * 2.0f);
+            std::size_t hits = 0;
+            for (const auto& coin : state->world->getCoins()) {
+                if (box.intersects(coin->getBoundingBox())) hits++;
+            }
+            doNotOptimize(hits);
+        };
+    }});
+
+    for (AabbKernel kernel : {AabbKernel::SCALAR, AabbKernel::SSE2, AabbKernel::AVX2}) {
+        if (static_cast<int>(kernel) > static_cast<int>(AabbBatch::detectKernel())) continue;
+
+        std::string name = std::string("broadphase/") + AabbBatch::kernelName(kernel) + "/" + mapName;
+        runner.add({name, 1000, [loader, seed, kernel]() -> std::function<void()> {
+            Random::getInstance().seed(seed);
+            auto state = std::make_shared<LoadedWorld>(loader);
+            auto positions = std::make_shared<std::vector<Position>>(randomPositions(*state->world, POSITION_POOL));
+            float radius = tileSizeOf(*state->world) * 0.4555f;
+
+            auto batch = std::make_shared<AabbBatch>();
+            batch->setKernel(kernel);
+            for (const auto& coin : state->world->getCoins()) {
+                batch->add(coin->getBoundingBox());
+            }
+
+            auto hits = std::make_shared<std::vector<std::uint32_t>>();
+            auto index = std::make_shared<std::size_t>(0);
+
+            return [positions, radius, batch, hits, index]() {
+                const Position& pos = (*positions)[(*index)++ % positions->size()];
+                BoundingBox box(pos.x - radius, pos.y - radius, radius * 2.0f, radius * 2.0f);
+                hits->clear();
+                batch->query(box, *hits);
+                doNotOptimize(hits->size());
+            };
+        }});
+    }
+
+    // Bewegende entities rond een punt (3x3 tiles, zoals een AI "wie is dichtbij" query):
+    // lineaire scan over alle ghosts vs World::queryDynamicEntities (spatial hash geforceerd)
+    runner.add({"neighbours/linear/" + mapName, 1000, [loader, seed]() -> std::function<void()> {
+        Random::getInstance().seed(seed);
+        auto state = std::make_shared<LoadedWorld>(loader);
+        auto positions = std::make_shared<std::vector<Position>>(randomPositions(*state->world, POSITION_POOL));
+        float halfSize = tileSizeOf(*state->world) * 1.5f;
+        auto index = std::make_shared<std::size_t>(0);
+
+        return [state, positions, halfSize, index]() {
+            const Position& pos = (*positions)[(*index)++ % positions->size()];
+            BoundingBox area(pos.x - halfSize, pos.y - halfSize, halfSize * 2.0f, halfSize * 2.0f);
+            std::size_t hits = 0;
+            for (const auto& ghost : state->world->getGhosts()) {
+                if (area.intersects(ghost->getBoundingBox())) hits++;
+            }
+            doNotOptimize(hits);
+        };
+    }});
+
+    runner.add({"neighbours/spatialhash/" + mapName, 1000, [loader, seed]() -> std::function<void()> {
+        Random::getInstance().seed(seed);
+        auto state = std::make_shared<LoadedWorld>(loader);
+        state->world->setSpatialHashMinGhosts(0);
+        auto positions = std::make_shared<std::vector<Position>>(randomPositions(*state->world, POSITION_POOL));
+        float halfSize = tileSizeOf(*state->world) * 1.5f;
+        auto ids = std::make_shared<std::vector<std::uint32_t>>();
+        auto index = std::make_shared<std::size_t>(0);
+
+        return [state, positions, halfSize, ids, index]() {
+            const Position& pos = (*positions)[(*index)++ % positions->size()];
+            BoundingBox area(pos.x - halfSize, pos.y - halfSize, halfSize * 2.0f, halfSize * 2.0f);
+            state->world->queryDynamicEntities(area, *ids);
+            doNotOptimize(ids->size());
+        };
+    }});
+
+    // Render culling: statische tiles (walls, coins, fruits) onder een viewport van 32x18 tiles,
+    // lineaire AABB test over alle tiles vs VisibilityIndex (zoals ConcreteFactory::collectVisibleViews)
+    auto staticTileBounds = [](const World& world) {
+        float half = tileSizeOf(world) / 2.0f;
+        auto bounds = std::make_shared<std::vector<BoundingBox>>();
+        const auto& components = world.getComponents();
+        for (const auto* transforms : {&components.wallTransforms, &components.coins.transforms,
+                                       &components.fruits.transforms}) {
+            for (const auto& transform : *transforms) {
+                const Position& pos = transform.position;
+                bounds->emplace_back(pos.x - half, pos.y - half, half * 2.0f, half * 2.0f);
+            }
+        }
+        return bounds;
+    };
+    auto viewportAround = [](const World& world, const Position& center) {
+        float tileSize = tileSizeOf(world);
+        return BoundingBox(center.x - tileSize * 16.0f, center.y - tileSize * 9.0f, tileSize * 32.0f, tileSize * 18.0f);
+    };
+
+    runner.add({"culling/linear/" + mapName, 100, [loader, seed, staticTileBounds, viewportAround]() -> std::function<void()> {
+        Random::getInstance().seed(seed);
+        auto state = std::make_shared<LoadedWorld>(loader);
+        auto positions = std::make_shared<std::vector<Position>>(randomPositions(*state->world, POSITION_POOL));
+        auto bounds = staticTileBounds(*state->world);
+        auto index = std::make_shared<std::size_t>(0);
+
+        return [state, positions, bounds, index, viewportAround]() {
+            BoundingBox area = viewportAround(*state->world, (*positions)[(*index)++ % positions->size()]);
+            std::size_t visible = 0;
+            for (const auto& box : *bounds) {
+                if (box.intersects(area)) visible++;
+            }
+            doNotOptimize(visible);
+        };
+    }});
+
+    runner.add({"culling/index/" + mapName, 100, [loader, seed, staticTileBounds, viewportAround]() -> std::function<void()> {
+        Random::getInstance().seed(seed);
+        auto state = std::make_shared<LoadedWorld>(loader);
+        auto positions = std::make_shared<std::vector<Position>>(randomPositions(*state->world, POSITION_POOL));
+        auto bounds = staticTileBounds(*state->world);
+
+        auto dims = state->world->getMapDimensions();
+        float worldWidth = static_cast<float>(dims.cols) / static_cast<float>(dims.rows);
+        auto visibility = std::make_shared<VisibilityIndex>();
+        visibility->setGrid(-worldWidth, -1.0f, tileSizeOf(*state->world), dims.cols, dims.rows);
+        for (std::uint32_t id = 0; id < bounds->size(); ++id) {
+            visibility->insert(id, (*bounds)[id]);
+        }
+        visibility->build();
+
+        auto ids = std::make_shared<std::vector<std::uint32_t>>();
+        auto index = std::make_shared<std::size_t>(0);
+
+        return [state, positions, visibility, ids, index, viewportAround]() {
+            BoundingBox area = viewportAround(*state->world, (*positions)[(*index)++ % positions->size()]);
+            visibility->query(area, *ids);
+            doNotOptimize(ids->size());
+        };
+    }});
+
+    runner.add({"ghost/getBestDirectionToTarget/" + mapName, 2000, [loader, seed]() -> std::function<void()> {
+        Random::getInstance().seed(seed);
+        auto state = std::make_shared<LoadedWorld>(loader);
+        auto positions = std::make_shared<std::vector<Position>>(randomPositions(*state->world, POSITION_POOL));
+        // Probe registreert zich in de GhostSystem van de World: moet voor de World verdwijnen
+        std::shared_ptr<ProbeGhost> ghost(new ProbeGhost(*state->world, Position(0, 0)),
+                                          [state](ProbeGhost* probe) { delete probe; });
+        ghost->setCollisionRadius(tileSizeOf(*state->world) * 0.45f);
+        Position target = state->world->getPacMan() ? state->world->getPacMan()->getPosition() : Position(0, 0);
+        auto index = std::make_shared<std::size_t>(0);
+
+        return [positions, ghost, target, index]() {
+            ghost->setPosition((*positions)[(*index)++ % positions->size()]);
+            Direction dir = ghost->getBestDirectionToTarget(target, false);
+            doNotOptimize(dir);
+        };
+    }});
+}
+
+/**
+ * @brief Scaling benchmarks op gegenereerde maps (MapGenerator, size x size)
+ *
+ * Zelfde benchmarks als voor de map files, plus de generator zelf.
+ */
+void registerGeneratedBenchmarks(BenchmarkRunner& runner, const std::vector<int>& sizes, int ghostCount,
+                                 unsigned int seed) {
+    for (int size : sizes) {
+        MapGeneratorConfig mapConfig;
+        mapConfig.rows = size;
+        mapConfig.cols = size;
+        mapConfig.seed = seed;
+        mapConfig.ghostCount = std::min(ghostCount, MapGenerator::maxGhosts(size));
+
+        std::string mapName = "gen_" + std::to_string(size) + "x" + std::to_string(size);
+        if (mapConfig.ghostCount != MapGeneratorConfig().ghostCount) {
+            mapName += "_g" + std::to_string(mapConfig.ghostCount);
+        }
+
+        runner.add({"mapgen/generate/" + mapName, 1, [mapConfig]() -> std::function<void()> {
+            return [mapConfig]() {
+                auto map = MapGenerator(mapConfig).generate();
+                doNotOptimize(map);
+            };
+        }});
+
+        auto mapData = std::make_shared<std::vector<std::string>>(MapGenerator(mapConfig).generate());
+        registerMapBenchmarks(runner, [mapData](World& world) { world.loadLevelFromData(*mapData); },
+                              mapName, seed);
+    }
+}
+
+void registerScoreBenchmarks(BenchmarkRunner& runner) {
+    runner.add({"score/onNotify", 100000, []() -> std::function<void()> {
+        auto score = std::make_shared<Score>();
+        auto index = std::make_shared<std::size_t>(0);
+
+        static const EventType types[] = {EventType::COIN_COLLECTED, EventType::ENTITY_UPDATED,
+                                          EventType::COIN_COLLECTED, EventType::FRUIT_COLLECTED,
+                                          EventType::GHOST_EATEN, EventType::LEVEL_CLEARED};
+
+        return [score, index]() {
+            Event event;
+            event.type = types[(*index)++ % (sizeof(types) / sizeof(types[0]))];
+            event.value = 10;
+            score->onNotify(event);
+            score->updateComboTimer(0.1f);
+        };
+    }});
+}
+
+void printUsage() {
+    std::cout << "Usage: PacManBench [--samples N] [--warmup N] [--filter TEXT] [--seed N]\n"
+              << "                   [--maps DIR] [--generated SIZES] [--generated-ghosts N] [--json FILE]\n"
+              << "  --generated SIZES     Comma separated MapGenerator sizes (default 32,64,128,256, '' = none)\n"
+              << "  --generated-ghosts N  Ghosts per generated map (default 4, capped per size)\n"
+              << "Run from the build directory (uses ../resources like the game)." << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    RunnerConfig config;
+    unsigned int seed = 12345;
+    std::string mapsDir = "../resources/maps";
+    std::string generatedSizes = "32,64,128,256";
+    int generatedGhosts = MapGeneratorConfig().ghostCount;
+    std::string jsonFile;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for " << arg << std::endl;
+                std::exit(2);
+            }
+            return argv[++i];
+        };
+
+        if (arg == "--samples") config.samples = std::stoul(next());
+        else if (arg == "--warmup") config.warmupSamples = std::stoul(next());
+        else if (arg == "--filter") config.filter = next();
+        else if (arg == "--seed") seed = static_cast<unsigned int>(std::stoul(next()));
+        else if (arg == "--maps") mapsDir = next();
+        else if (arg == "--generated") generatedSizes = next();
+        else if (arg == "--generated-ghosts") generatedGhosts = std::stoi(next());
+        else if (arg == "--json") jsonFile = next();
+        else if (arg == "--help" || arg == "-h") {
+            printUsage();
+            return 0;
+        } else {
+            std::cerr << "Unknown argument: " << arg << std::endl;
+            printUsage();
+            return 2;
+        }
+    }
+
+    try {
+        BenchmarkRunner runner(config);
+
+        for (const auto& map : findMaps(mapsDir)) {
+            std::string mapFile = map.string();
+            registerMapBenchmarks(runner, [mapFile](World& world) { world.loadLevel(mapFile); },
+                                  map.stem().string(), seed);
+        }
+        registerGeneratedBenchmarks(runner, parseSizes(generatedSizes), generatedGhosts, seed);
+        registerScoreBenchmarks(runner);
+
+        auto results = runner.run();
+
+        if (!jsonFile.empty() && !BenchmarkRunner::writeJson(results, config, seed, jsonFile)) {
+            return 1;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "PacManBench error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,150 @@
+#include "BenchmarkRunner.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+namespace pacman::bench {
+
+namespace {
+
+double median(std::vector<double> values) {
+    if (values.empty()) return 0.0;
+
+    std::sort(values.begin(), values.end());
+    std::size_t mid = values.size() / 2;
+    if (values.size() % 2 == 0) {
+        return (values[mid - 1] + values[mid]) / 2.0;
+    }
+    return values[mid];
+}
+
+// Escape enkel wat in benchmark namen kan voorkomen
+std::string jsonEscape(const std::string& text) {
+    std::string out;
+    for (char c : text) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+} // namespace
+
+BenchmarkResult BenchmarkRunner::runOne(const Benchmark& benchmark) const {
+    using Clock = std::chrono::steady_clock;
+
+    BenchmarkResult result;
+    result.name = benchmark.name;
+    result.batchSize = benchmark.batchSize;
+
+    const std::size_t totalSamples = config.warmupSamples + config.samples;
+    for (std::size_t sample = 0; sample < totalSamples; ++sample) {
+        auto op = benchmark.prepare();
+
+        auto start = Clock::now();
+        for (std::size_t i = 0; i < benchmark.batchSize; ++i) {
+            op();
+        }
+        auto end = Clock::now();
+
+        if (sample < config.warmupSamples) continue;
+
+        double ns = std::chrono::duration<double, std::nano>(end - start).count();
+        result.samplesNs.push_back(ns / static_cast<double>(benchmark.batchSize));
+    }
+
+    result.medianNs = median(result.samplesNs);
+
+    std::vector<double> deviations;
+    deviations.reserve(result.samplesNs.size());
+    for (double s : result.samplesNs) {
+        deviations.push_back(std::abs(s - result.medianNs));
+    }
+    result.madNs = median(deviations);
+
+    auto [minIt, maxIt] = std::minmax_element(result.samplesNs.begin(), result.samplesNs.end());
+    result.minNs = minIt != result.samplesNs.end() ? *minIt : 0.0;
+    result.maxNs = maxIt != result.samplesNs.end() ? *maxIt : 0.0;
+    result.opsPerSecond = result.medianNs > 0.0 ? 1e9 / result.medianNs : 0.0;
+
+    return result;
+}
+
+std::vector<BenchmarkResult> BenchmarkRunner::run() const {
+    std::vector<BenchmarkResult> results;
+
+    std::cout << std::left << std::setw(44) << "benchmark" << std::right
+              << std::setw(14) << "median ns/op" << std::setw(10) << "MAD %"
+              << std::setw(14) << "min ns/op" << std::setw(16) << "ops/s" << std::endl;
+
+    for (const auto& benchmark : benchmarks) {
+        if (!config.filter.empty() && benchmark.name.find(config.filter) == std::string::npos) {
+            continue;
+        }
+
+        BenchmarkResult result = runOne(benchmark);
+        double madPercent = result.medianNs > 0.0 ? 100.0 * result.madNs / result.medianNs : 0.0;
+
+        std::cout << std::left << std::setw(44) << result.name << std::right << std::fixed
+                  << std::setprecision(1) << std::setw(14) << result.medianNs
+                  << std::setw(10) << madPercent << std::setw(14) << result.minNs
+                  << std::setprecision(0) << std::setw(16) << result.opsPerSecond << std::endl;
+
+        results.push_back(std::move(result));
+    }
+
+    return results;
+}
+
+bool BenchmarkRunner::writeJson(const std::vector<BenchmarkResult>& results, const RunnerConfig& config,
+                                unsigned int seed, const std::string& filename) {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "PacManBench: could not open JSON output: " << filename << std::endl;
+        return false;
+    }
+
+    file << std::fixed << std::setprecision(3);
+    file << "{\n";
+    file << "  \"context\": {\n";
+#ifdef __VERSION__
+    file << "    \"compiler\": \"" << jsonEscape(__VERSION__) << "\",\n";
+#endif
+#ifdef NDEBUG
+    file << "    \"build\": \"release\",\n";
+#else
+    file << "    \"build\": \"debug\",\n";
+#endif
+    file << "    \"hardware_threads\": " << std::thread::hardware_concurrency() << ",\n";
+    file << "    \"seed\": " << seed << ",\n";
+    file << "    \"warmup_samples\": " << config.warmupSamples << ",\n";
+    file << "    \"samples\": " << config.samples << "\n";
+    file << "  },\n";
+    file << "  \"benchmarks\": [";
+
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const auto& r = results[i];
+        file << (i == 0 ? "\n" : ",\n");
+        file << "    {\"name\": \"" << jsonEscape(r.name) << "\""
+             << ", \"batch_size\": " << r.batchSize
+             << ", \"median_ns\": " << r.medianNs
+             << ", \"mad_ns\": " << r.madNs
+             << ", \"min_ns\": " << r.minNs
+             << ", \"max_ns\": " << r.maxNs
+             << ", \"ops_per_second\": " << r.opsPerSecond
+             << ", \"samples_ns\": [";
+        for (std::size_t s = 0; s < r.samplesNs.size(); ++s) {
+            file << (s == 0 ? "" : ", ") << r.samplesNs[s];
+        }
+        file << "]}";
+    }
+
+    file << "\n  ]\n}\n";
+    return true;
+}
+
+} // namespace pacman::bench
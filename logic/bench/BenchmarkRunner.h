@@ -0,0 +1,89 @@
+#pragma once
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace pacman::bench {
+
+/**
+ * @brief Eén benchmark definitie
+ *
+ * - prepare(): ONGETIMED, bouwt state op (World laden, posities genereren)
+ *   en geeft de te meten operatie terug (closure die de state ownt)
+ * - batchSize: aantal keer dat op() per sample wordt uitgevoerd
+ *
+ * Resultaten worden per operatie gerapporteerd (ns/op).
+ */
+struct Benchmark {
+    std::string name;
+    std::size_t batchSize = 1;
+    std::function<std::function<void()>()> prepare;
+};
+
+/**
+ * @brief Statistieken van één benchmark
+ *
+ * median + MAD (median absolute deviation) zijn robuust tegen uitschieters
+ * (context switches, page faults), in tegenstelling tot mean + stddev.
+ */
+struct BenchmarkResult {
+    std::string name;
+    std::size_t batchSize = 0;
+    std::vector<double> samplesNs;  // ns/op per sample (zonder warmup)
+    double medianNs = 0.0;
+    double madNs = 0.0;
+    double minNs = 0.0;
+    double maxNs = 0.0;
+    double opsPerSecond = 0.0;
+};
+
+struct RunnerConfig {
+    std::size_t warmupSamples = 3;
+    std::size_t samples = 20;
+    std::string filter;  // Substring match op naam, leeg = alles
+};
+
+/**
+ * @brief Voert benchmarks uit en rapporteert (console + JSON)
+ */
+class BenchmarkRunner {
+public:
+    explicit BenchmarkRunner(RunnerConfig config) : config(std::move(config)) {}
+
+    void add(Benchmark benchmark) { benchmarks.push_back(std::move(benchmark)); }
+
+    /**
+     * @brief Voer alle (gefilterde) benchmarks uit
+     * @return Resultaten in registratie volgorde
+     */
+    std::vector<BenchmarkResult> run() const;
+
+    /**
+     * @brief Schrijf resultaten als JSON
+     * @return true bij succes
+     */
+    static bool writeJson(const std::vector<BenchmarkResult>& results, const RunnerConfig& config,
+                          unsigned int seed, const std::string& filename);
+
+private:
+    RunnerConfig config;
+    std::vector<Benchmark> benchmarks;
+
+    BenchmarkResult runOne(const Benchmark& benchmark) const;
+};
+
+/**
+ * @brief Voorkom dat de compiler een resultaat weg-optimaliseert
+ */
+template<typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const T* sink;
+    sink = &value;
+#endif
+}
+
+} // namespace pacman::bench
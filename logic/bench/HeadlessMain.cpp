@@ -0,0 +1,232 @@
+#include "logic/HeadlessFactory.h"
+#include "logic/MapGenerator.h"
+#include "logic/World.h"
+#include "logic/entities/Ghost.h"
+#include "logic/utils/Random.h"
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace pacman;
+
+namespace {
+
+constexpr float FRAME_TIME = 1.0f / 60.0f;
+
+struct HeadlessConfig {
+    std::string mapFile;             // Leeg: gebruik MapGenerator
+    MapGeneratorConfig generator;
+    std::vector<int> sweepSizes;     // Niet leeg: run per size (size x size)
+    std::string dumpFile;
+    int ticks = 600;
+    unsigned int seed = 12345;
+    MovementMode movementMode = MovementMode::CONTINUOUS;
+    EntityStorage entityStorage = EntityStorage::OBJECTS;
+};
+
+/**
+ * @brief Resultaat van één headless run (één CSV rij)
+ */
+struct RunResult {
+    int rows = 0;
+    int cols = 0;
+    std::size_t walls = 0;
+    std::size_t coins = 0;
+    std::size_t fruits = 0;
+    std::size_t ghosts = 0;
+    int ticks = 0;
+    std::size_t entityBytes = 0;  // Models in de arena + component arrays
+    double loadMs = 0.0;
+    double nsPerTick = 0.0;
+};
+
+std::vector<int> parseSizes(const std::string& list) {
+    std::vector<int> sizes;
+    std::stringstream ss(list);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        if (!item.empty()) {
+            sizes.push_back(std::stoi(item));
+        }
+    }
+    return sizes;
+}
+
+/**
+ * @brief Laad map, simuleer ticks met vaste timestep en meet
+ *
+ * PacMan loopt continu naar links (zelfde scenario als world/update in PacManBench).
+ */
+RunResult runWorld(const std::vector<std::string>* mapData, const std::string& mapFile,
+                   int ticks, unsigned int seed, MovementMode movementMode, EntityStorage entityStorage) {
+    using Clock = std::chrono::steady_clock;
+
+    Random::getInstance().seed(seed);
+
+    LevelArena arena;
+    HeadlessFactory factory;
+    factory.setArena(&arena);
+    World world(factory, nullptr);
+    world.setMovementMode(movementMode);
+    world.setEntityStorage(entityStorage);
+
+    auto loadStart = Clock::now();
+    if (mapData) {
+        world.loadLevelFromData(*mapData);
+    } else {
+        world.loadLevel(mapFile);
+    }
+    auto loadEnd = Clock::now();
+
+    if (auto* pacman = world.getPacMan()) {
+        pacman->setDirection(Direction::LEFT);
+    }
+
+    auto tickStart = Clock::now();
+    for (int i = 0; i < ticks; ++i) {
+        world.update(FRAME_TIME);
+    }
+    auto tickEnd = Clock::now();
+
+    RunResult result;
+    auto dims = world.getMapDimensions();
+    result.rows = dims.rows;
+    result.cols = dims.cols;
+    const auto& components = world.getComponents();  // Zelfde tellingen in beide storage modes
+    result.walls = components.wallTransforms.size();
+    result.coins = components.coins.size();
+    result.fruits = components.fruits.size();
+    result.ghosts = world.getGhosts().size();
+    result.ticks = ticks;
+    result.entityBytes = arena.getBytesAllocated() + components.getMemoryUsage();
+    result.loadMs = std::chrono::duration<double, std::milli>(loadEnd - loadStart).count();
+    result.nsPerTick = ticks > 0
+        ? std::chrono::duration<double, std::nano>(tickEnd - tickStart).count() / ticks
+        : 0.0;
+    return result;
+}
+
+void printHeader() {
+    std::cout << "rows,cols,walls,coins,fruits,ghosts,ticks,entity_bytes,load_ms,ns_per_tick" << std::endl;
+}
+
+void printRow(const RunResult& r) {
+    std::cout << std::fixed << std::setprecision(3)
+              << r.rows << "," << r.cols << "," << r.walls << "," << r.coins << ","
+              << r.fruits << "," << r.ghosts << "," << r.ticks << "," << r.entityBytes << ","
+              << r.loadMs << "," << r.nsPerTick << std::endl;
+}
+
+void printUsage() {
+    std::cout << "Usage: PacManHeadless [--map FILE | --size ROWSxCOLS | --sweep SIZES] [options]\n"
+              << "  --map FILE            Run a map file (World::loadLevel)\n"
+              << "  --size ROWSxCOLS      Generate a map (default 21x21, max 1000x1000)\n"
+              << "  --sweep SIZES         Generate and run size x size for each (e.g. 32,64,128,256)\n"
+              << "  --ghosts N            Ghost spawns in generated maps (default 4, >4 uses 'g' tiles)\n"
+              << "  --fruit-density F     Fruit chance per corridor tile (default 0.01)\n"
+              << "  --braid F             Dead end removal chance (default 1.0)\n"
+              << "  --no-door             Generate ghost house without door\n"
+              << "  --ticks N             Simulated ticks at 60 Hz (default 600)\n"
+              << "  --seed N              Seed for generator and game Random (default 12345)\n"
+              << "  --lattice             Tile lattice movement (MovementMode::TILE_LATTICE)\n"
+              << "  --components          Walls, coins and fruits as component arrays only (EntityStorage::COMPONENTS)\n"
+              << "  --dump FILE           Write the generated map (World map format) and exit\n"
+              << "Output: CSV (rows,cols,walls,coins,fruits,ghosts,ticks,entity_bytes,load_ms,ns_per_tick)." << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    HeadlessConfig config;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&]() -> std::string {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for " << arg << std::endl;
+                std::exit(2);
+            }
+            return argv[++i];
+        };
+
+        if (arg == "--map") config.mapFile = next();
+        else if (arg == "--size") {
+            std::string value = next();
+            auto split = value.find('x');
+            if (split == std::string::npos) {
+                config.generator.rows = config.generator.cols = std::stoi(value);
+            } else {
+                config.generator.rows = std::stoi(value.substr(0, split));
+                config.generator.cols = std::stoi(value.substr(split + 1));
+            }
+        }
+        else if (arg == "--sweep") config.sweepSizes = parseSizes(next());
+        else if (arg == "--ghosts") config.generator.ghostCount = std::stoi(next());
+        else if (arg == "--fruit-density") config.generator.fruitDensity = std::stof(next());
+        else if (arg == "--braid") config.generator.braidFactor = std::stof(next());
+        else if (arg == "--no-door") config.generator.door = false;
+        else if (arg == "--ticks") config.ticks = std::stoi(next());
+        else if (arg == "--seed") config.seed = static_cast<unsigned int>(std::stoul(next()));
+        else if (arg == "--dump") config.dumpFile = next();
+        else if (arg == "--lattice") config.movementMode = MovementMode::TILE_LATTICE;
+        else if (arg == "--components") config.entityStorage = EntityStorage::COMPONENTS;
+        else if (arg == "--help" || arg == "-h") {
+            printUsage();
+            return 0;
+        } else {
+            std::cerr << "Unknown argument: " << arg << std::endl;
+            printUsage();
+            return 2;
+        }
+    }
+
+    config.generator.seed = config.seed;
+
+    try {
+        if (!config.mapFile.empty()) {
+            printHeader();
+            printRow(runWorld(nullptr, config.mapFile, config.ticks, config.seed,
+                              config.movementMode, config.entityStorage));
+            return 0;
+        }
+
+        if (config.sweepSizes.empty()) {
+            config.sweepSizes.push_back(0);  // Enkel --size (of default)
+        }
+
+        bool headerPrinted = false;
+        for (int size : config.sweepSizes) {
+            MapGeneratorConfig generatorConfig = config.generator;
+            if (size > 0) {
+                generatorConfig.rows = size;
+                generatorConfig.cols = size;
+            }
+
+            auto mapData = MapGenerator(generatorConfig).generate();
+
+            if (!config.dumpFile.empty()) {
+                MapGenerator::writeToFile(mapData, config.dumpFile);
+                std::cout << "Wrote " << mapData.size() << "x" << mapData.front().size()
+                          << " map to " << config.dumpFile << std::endl;
+                return 0;
+            }
+
+            if (!headerPrinted) {
+                printHeader();
+                headerPrinted = true;
+            }
+            printRow(runWorld(&mapData, "", config.ticks, config.seed,
+                              config.movementMode, config.entityStorage));
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "PacManHeadless error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    return 0;
+}
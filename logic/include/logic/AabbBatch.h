@@ -0,0 +1,95 @@
+#pragma once
+#include "logic/EntityModel.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace pacman {
+
+/**
+ * @brief SIMD kernel voor AabbBatch::query
+ */
+enum class AabbKernel {
+    SCALAR,
+    SSE2,   // 4 boxes per instructie
+    AVX2    // 8 boxes per instructie
+};
+
+/**
+ * @brief Broad-phase: veel AABBs in SoA float arrays, getest tegen één box
+ *
+ * === DOEL ===
+ * World::handleCollisions testte PacMan tegen elke coin, fruit en ghost via
+ * virtual EntityModel::intersects (2x virtual getBoundingBox per test).
+ * AabbBatch bewaart left/top/right/bottom in aparte arrays en test 4 (SSE2)
+ * of 8 (AVX2) boxes per instructie.
+ *
+ * === EXACTHEID ===
+ * Zelfde predicaat als BoundingBox::intersects:
+ *   !(right < other.left || left > other.right || bottom < other.top || top > other.bottom)
+ * right/bottom worden bij add() berekend als left + width (zelfde float
+ * expressie), en de SIMD vergelijkingen zijn de "not less/greater than"
+ * varianten zodat ook NaN zich identiek gedraagt. Hits zijn dus exact
+ * dezelfde als met intersects().
+ *
+ * === KERNEL KEUZE ===
+ * Runtime (CPUID): AVX2 indien beschikbaar, anders SSE2 (x86-64 baseline),
+ * anders scalar (bv. ARM builds). setKernel() forceert een kernel (benchmarks).
+ *
+ * Uitgeschakelde boxes (disable()) en padding tot een veelvoud van 8 matchen
+ * nooit, dus kernels hebben geen tail loop.
+ */
+class AabbBatch {
+public:
+    AabbBatch();
+
+    void clear();
+    void reserve(std::size_t count);
+
+    /**
+     * @brief Voeg box toe
+     * @return Index van de box (= volgorde van toevoegen)
+     */
+    std::size_t add(const BoundingBox& box);
+
+    /**
+     * @brief Overschrijf box op index (bv. bewegende entity)
+     */
+    void set(std::size_t index, const BoundingBox& box);
+
+    /**
+     * @brief Box matcht nooit meer (bv. coin opgepakt)
+     */
+    void disable(std::size_t index);
+
+    std::size_t size() const { return count; }
+
+    /**
+     * @brief Zoek alle boxes die box raken
+     * @param box Query box (bv. PacMan)
+     * @param hits Output: indices in stijgende volgorde (wordt NIET geleegd)
+     */
+    void query(const BoundingBox& box, std::vector<std::uint32_t>& hits) const;
+
+    void setKernel(AabbKernel kernel);
+    AabbKernel getKernel() const { return kernel; }
+
+    /**
+     * @brief Beste kernel voor deze CPU
+     */
+    static AabbKernel detectKernel();
+    static const char* kernelName(AabbKernel kernel);
+
+    static constexpr std::size_t LANES = 8;  // Padding granulariteit (AVX2 breedte)
+
+private:
+    std::size_t count = 0;
+    std::vector<float> lefts;
+    std::vector<float> tops;
+    std::vector<float> rights;
+    std::vector<float> bottoms;
+
+    AabbKernel kernel;
+};
+
+} // namespace pacman
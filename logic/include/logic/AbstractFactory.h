@@ -1,4 +1,6 @@
  #pragma once
+#include "logic/EntityRegistry.h"
+#include "logic/LevelArena.h"
 #include <memory>
 
 namespace pacman {
@@ -30,7 +32,8 @@ enum class GhostColor;
  *
  * === OBSERVER ATTACHMENT ===
  * Factory is verantwoordelijk voor:
- * - Creëren van Model (unique_ptr)
+ * - Creëren van Model (EntityPtr, in de LevelArena als die gezet is)
+ * - Registreren van Model in de EntityRegistry (handle voor Views)
  * - Creëren van View (stored in ConcreteFactory)
  * - Attachen van View als Observer aan Model
  */
@@ -38,19 +41,49 @@ class AbstractFactory {
 public:
     virtual ~AbstractFactory() = default;
 
-    virtual std::unique_ptr<PacMan> createPacMan(const Position& pos) = 0;
-    virtual std::unique_ptr<Coin> createCoin(const Position& pos) = 0;
-    virtual std::unique_ptr<Fruit> createFruit(const Position& pos) = 0;
-    virtual std::unique_ptr<Wall> createWall(const Position& pos) = 0;
+    virtual EntityPtr<PacMan> createPacMan(const Position& pos) = 0;
+    virtual EntityPtr<Coin> createCoin(const Position& pos) = 0;
+    virtual EntityPtr<Fruit> createFruit(const Position& pos) = 0;
+    virtual EntityPtr<Wall> createWall(const Position& pos) = 0;
 
     /**
      * @brief Creëer ghost met specifieke AI
      * @param world Reference naar World (ghosts hebben toegang nodig voor pathfinding)
      * @param pos Spawn positie
      * @param color Ghost kleur (bepaalt AI type en visual)
-     * @return unique_ptr naar Ghost subclass
+     * @return EntityPtr naar Ghost subclass
      */
-    virtual std::unique_ptr<Ghost> createGhost(World& world, const Position& pos, GhostColor color) = 0;
+    virtual EntityPtr<Ghost> createGhost(World& world, const Position& pos, GhostColor color) = 0;
+
+    /**
+     * @brief Alloceer Models (en Views) voortaan in arena (nullptr = heap)
+     *
+     * De arena moet de factory en de World outliven (zie LevelArena).
+     */
+    void setArena(LevelArena* levelArena) { arena = levelArena; }
+    LevelArena* getArena() const { return arena; }
+
+    /**
+     * @brief Registry met een handle voor elk Model van deze factory
+     *
+     * Gedeeld (shared_ptr) met World en Views: blijft geldig ongeacht welke
+     * van de drie eerst vernietigd wordt.
+     */
+    const std::shared_ptr<EntityRegistry>& getRegistry() const { return registry; }
+
+protected:
+    /**
+     * @brief Creëer Model (arena of heap) en registreer het in de registry
+     */
+    template <typename T, typename... Args>
+    EntityPtr<T> makeModel(Args&&... args) {
+        auto model = makeEntity<T>(arena, std::forward<Args>(args)...);
+        model->registerIn(*registry);
+        return model;
+    }
+
+    LevelArena* arena = nullptr;
+    std::shared_ptr<EntityRegistry> registry = std::make_shared<EntityRegistry>();
 };
 
 } // namespace pacman
\ No newline at end of file
@@ -1,8 +1,60 @@
 #pragma once
+#include "logic/EntityModel.h"
 #include "logic/utils/Position.h"
 
 namespace pacman {
 
+/**
+ * @brief FIT_MAP: hele map in de viewport, FOLLOW: ingezoomd, volgt PacMan
+ */
+enum class CameraMode {
+    FIT_MAP,
+    FOLLOW
+};
+
+/**
+ * @brief Instellingen voor CameraMode::FOLLOW
+ */
+struct CameraFollowSettings {
+    float visibleRows = 21.0f;   // Zoom: aantal tiles verticaal in beeld
+    float maxAspect = 4.0f / 3.0f;  // Breedte/hoogte van het zichtbare stuk (sidebars blijven)
+    float deadZone = 0.25f;      // Fractie van het halve beeld waarin PacMan vrij beweegt
+    float smoothing = 6.0f;      // 1/s: hoe snel de camera de dead zone inhaalt
+};
+
+/**
+ * @brief Kopie van de camera projectie (plain data, per frame één keer gemaakt)
+ *
+ * Camera::getTransform() rekent alles één keer uit; wie per entity projecteert
+ * (Views, batches) gebruikt deze struct i.p.v. de Camera zelf: geen
+ * shared_ptr/weak_ptr lock, geen herberekening van de sprite size.
+ * worldToScreen() geeft exact hetzelfde resultaat als Camera::worldToScreen().
+ */
+struct CameraTransform {
+    float screenCenterX = 0.0f;   // viewportOffsetX + viewportWidth / 2
+    float screenCenterY = 0.0f;
+    float centerX = 0.0f;         // World positie in het midden van de viewport
+    float centerY = 0.0f;
+    float scale = 1.0f;           // Pixels per world unit
+    float spriteSize = 0.0f;      // Camera::getSpriteSize()
+    float tileSize = 0.0f;        // Camera::getTileWorldSize()
+    float visibleHalfWidth = 0.0f;
+    float visibleHalfHeight = 0.0f;
+
+    Position worldToScreen(const Position& worldPos) const {
+        return Position(screenCenterX + (worldPos.x - centerX) * scale,
+                        screenCenterY + (worldPos.y - centerY) * scale);
+    }
+
+    /**
+     * @brief Camera::getVisibleWorldBounds()
+     */
+    BoundingBox visibleBounds() const {
+        return BoundingBox(centerX - visibleHalfWidth, centerY - visibleHalfHeight,
+                           2.0f * visibleHalfWidth, 2.0f * visibleHalfHeight);
+    }
+};
+
 /**
  * @brief Camera - projectie van world coordinates naar screen pixels
  *
@@ -24,6 +76,15 @@ namespace pacman {
  *
  * Dit voorkomt stretching/squashing van sprites.
  *
+ * === FOLLOW MODE ===
+ * setMode(FOLLOW): de viewport toont visibleRows x (visibleRows * maxAspect) tiles
+ * rond center (of de hele map als die kleiner is). update(target, dt):
+ * - Dead zone: center beweegt pas als het target buiten deadZone * halve view komt
+ * - Smoothing: exponentieel naar de gewenste center (framerate onafhankelijk)
+ * - Clamp: nooit voorbij de map rand (as kleiner dan de view → gecentreerd)
+ * Views tekenen buiten de viewport: LevelState maskeert die zone.
+ * FIT_MAP (default) heeft center (0, 0): exact de oude projectie.
+ *
  * === SPRITE SIZING ===
  * getSpriteSize() berekent sprite size op basis van:
  * - Tile size in world units (2.0 / mapRows)
@@ -40,8 +101,8 @@ public:
      * @return Position in screen space (pixels)
      *
      * Formule:
-     * screenX = viewportOffsetX + (viewportWidth / 2) + worldPos.x * scale
-     * screenY = viewportOffsetY + (viewportHeight / 2) + worldPos.y * scale
+     * screenX = viewportOffsetX + (viewportWidth / 2) + (worldPos.x - center.x) * scale
+     * screenY = viewportOffsetY + (viewportHeight / 2) + (worldPos.y - center.y) * scale
      */
     Position worldToScreen(const Position& worldPos) const;
 
@@ -61,6 +122,17 @@ public:
      */
     float getSpriteSize() const;
 
+    /**
+     * @brief World rechthoek die in de viewport valt (voor visibility culling)
+     * @return AABB in world space: center ± zichtbare halve breedte/hoogte
+     */
+    BoundingBox getVisibleWorldBounds() const;
+
+    /**
+     * @brief Zijde van één map tile in world units (2.0 / mapRows)
+     */
+    float getTileWorldSize() const { return 2.0f * worldHeight / mapRows; }
+
     /**
      * @brief Update map dimensies (triggert scale recalculatie)
      * @param rows Aantal rijen in map
@@ -75,11 +147,43 @@ public:
      */
     void setWindowSize(int width, int height);
 
+    /**
+     * @brief Kies FIT_MAP of FOLLOW (herberekent scale, center terug naar clamp)
+     */
+    void setMode(CameraMode mode);
+    CameraMode getMode() const { return mode; }
+
+    void setFollowSettings(const CameraFollowSettings& settings);
+    const CameraFollowSettings& getFollowSettings() const { return followSettings; }
+
+    /**
+     * @brief Volg target (FOLLOW): dead zone, smoothing, clamp aan de map
+     * @param target Meestal PacMan positie
+     * @param deltaTime Frame tijd (seconden)
+     *
+     * No-op in FIT_MAP.
+     */
+    void update(const Position& target, float deltaTime);
+
+    /**
+     * @brief Center meteen op target (level start, geen smoothing)
+     */
+    void snapTo(const Position& target);
+
+    Position getCenter() const { return center; }
+
+    /**
+     * @brief Projectie van dit moment als plain struct (voor de render pass)
+     */
+    CameraTransform getTransform() const;
+
     // Getters voor viewport berekeningen
     int getWindowWidth() const { return windowWidth; }
     int getWindowHeight() const { return windowHeight; }
     float getWorldWidth() const { return worldWidth; }
     float getWorldHeight() const { return worldHeight; }
+    int getMapRows() const { return mapRows; }
+    int getMapCols() const { return mapCols; }
 
     // Letterbox offsets (voor UI positioning buiten viewport)
     float getViewportOffsetX() const { return viewportOffsetX; }
@@ -99,6 +203,12 @@ private:
     float worldWidth = 1.82f;   // Berekend uit aspect ratio
     float worldHeight = 1.0f;   // Vast
 
+    CameraMode mode = CameraMode::FIT_MAP;
+    CameraFollowSettings followSettings;
+    Position center{0.0f, 0.0f};  // World positie in het midden van de viewport
+    float visibleHalfWidth = 1.82f;   // Zichtbare halve breedte (world units)
+    float visibleHalfHeight = 1.0f;
+
     // Viewport (met letterboxing)
     float viewportOffsetX = 0.0f;
     float viewportOffsetY = 0.0f;
@@ -115,6 +225,11 @@ private:
      * 4. Bereken viewport size en letterbox offsets
      */
     void calculateScale();
+
+    /**
+     * @brief Houd center binnen de map (per as: centreren als de view groter is)
+     */
+    Position clampCenter(const Position& desired) const;
 };
 
 } // namespace pacman
\ No newline at end of file
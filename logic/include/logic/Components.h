@@ -0,0 +1,103 @@
+#pragma once
+#include "logic/EntityModel.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace pacman {
+
+/**
+ * @brief Hoe World statische entities (walls, coins, fruits) bewaart
+ */
+enum class EntityStorage {
+    OBJECTS,     // Component arrays + een EntityModel per entity via de factory (Views, default)
+    COMPONENTS   // Enkel component arrays (headless, grote maps): geen Models of Views
+};
+
+// === COMPONENTS ===
+// Plain data, dicht opeengepakt per type (index = entity id binnen dat type)
+
+struct Transform {
+    Position position;
+};
+
+struct Collider {
+    float radius = 0.0f;
+
+    /**
+     * @brief Zelfde box (bit-exact) als EntityModel::getBoundingBox()
+     */
+    BoundingBox boxAt(const Position& pos) const {
+        float size = radius * 2.0f;
+        return BoundingBox(pos.x - size / 2.0f, pos.y - size / 2.0f, size, size);
+    }
+};
+
+enum class CollectibleKind : std::uint8_t {
+    COIN,
+    FRUIT
+};
+
+struct Collectible {
+    std::int32_t points = 0;
+    CollectibleKind kind = CollectibleKind::COIN;
+    bool collected = false;
+};
+
+/**
+ * @brief Component arrays van één soort collectible (coins of fruits)
+ */
+struct CollectibleArrays {
+    std::vector<Transform> transforms;
+    std::vector<Collider> colliders;
+    std::vector<Collectible> states;
+    std::size_t remaining = 0;
+
+    std::size_t size() const { return transforms.size(); }
+
+    void clear();
+    void add(const Position& pos, CollectibleKind kind, std::int32_t points);
+    void setRadius(float radius);
+
+    /**
+     * @brief Markeer als opgeraapt
+     * @return false als het al opgeraapt was
+     */
+    bool collect(std::size_t index);
+};
+
+/**
+ * @brief Component storage voor de statische entities van een level
+ *
+ * === DOEL ===
+ * Elk EntityModel draagt position, speed, collision radius, een Subject
+ * observer vector, een vtable en een registry handle (~100 bytes, plus de
+ * View). Voor een wall is enkel de positie nodig: hier is dat één Transform
+ * (8 bytes), de radius is per map gelijk (wallRadius).
+ *
+ * === SYSTEMS (in World) ===
+ * - Collision: buildWallTiles() leest wallTransforms → WallRects
+ * - Pickup + scoring: handleCollisions() markeert Collectibles en stuurt
+ *   COIN_COLLECTED / FRUIT_COLLECTED naar Score (via het Model als dat bestaat)
+ * - Movement + AI: GhostSystem (SoA per ghost) en PacMan
+ * - Level einde: remaining tellers i.p.v. een scan over alle coins
+ *
+ * In beide EntityStorage modes is dit de bron van waarheid; in OBJECTS mode
+ * bestaan de Models ernaast voor Views en observers.
+ */
+struct ComponentStore {
+    std::vector<Transform> wallTransforms;
+    float wallRadius = 0.0f;
+
+    CollectibleArrays coins;
+    CollectibleArrays fruits;
+
+    void clear();
+
+    /**
+     * @brief Bytes in de component arrays (capacity, zonder de vector headers)
+     */
+    std::size_t getMemoryUsage() const;
+};
+
+} // namespace pacman
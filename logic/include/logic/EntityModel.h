@@ -2,6 +2,7 @@
 #include "logic/utils/Position.h"
 #include "logic/utils/Types.h"
 #include "logic/patterns/Subject.h"
+#include "logic/EntityRegistry.h"
 #include <memory>
 
 namespace pacman {
@@ -44,15 +45,47 @@ struct BoundingBox {
  * - Snelheid voor movement
  * - Collision detection via bounding boxes
  * - Observer pattern (Subject) voor view updates
+ * - Handle in de EntityRegistry (Views houden de handle vast, niet het Model)
  *
  * Subklassen moeten update() implementeren voor entity-specifieke logica.
+ *
+ * Niet kopieerbaar (een handle hoort bij één object). Een move neemt de
+ * registratie over en verplaatst het registry slot naar het nieuwe adres.
  */
 class EntityModel : public Subject {
 public:
     EntityModel(const Position& pos, float speed = 0.0f)
         : position(pos), speed(speed) {}
 
-    virtual ~EntityModel() = default;
+    EntityModel(const EntityModel&) = delete;
+    EntityModel& operator=(const EntityModel&) = delete;
+
+    EntityModel(EntityModel&& other) noexcept
+        : Subject(std::move(other)), position(other.position), speed(other.speed),
+          collisionRadius(other.collisionRadius), registry(other.registry), handle(other.handle) {
+        other.registry = nullptr;
+        other.handle = EntityHandle();
+        if (registry) registry->relocate(handle, *this);
+    }
+
+    EntityModel& operator=(EntityModel&&) = delete;
+
+    virtual ~EntityModel() {
+        if (registry) registry->remove(handle);
+    }
+
+    /**
+     * @brief Registreer in registry (eenmalig, AbstractFactory doet dit per Model)
+     *
+     * De registry moet deze entity outliven.
+     */
+    void registerIn(EntityRegistry& entityRegistry) {
+        if (registry) registry->remove(handle);
+        registry = &entityRegistry;
+        handle = entityRegistry.add(*this);
+    }
+
+    EntityHandle getHandle() const { return handle; }
 
     /**
      * @brief Update entity state (pure virtual)
@@ -67,9 +100,9 @@ public:
     Position getPosition() const { return position; }
     float getSpeed() const { return speed; }
 
-    // Setters
-    void setPosition(const Position& pos) { position = pos; }
-    void setSpeed(float spd) { speed = spd; }
+    // Setters (virtual: Ghost schrijft door naar zijn GhostSystem slot)
+    virtual void setPosition(const Position& pos) { position = pos; }
+    virtual void setSpeed(float spd) { speed = spd; }
 
     /**
      * @brief Verkrijg collision box voor deze entity
@@ -89,7 +122,7 @@ public:
     }
 
     virtual float getCollisionRadius() const { return collisionRadius; }
-    void setCollisionRadius(float radius) { collisionRadius = radius; }
+    virtual void setCollisionRadius(float radius) { collisionRadius = radius; }
 
     /**
      * @brief Check of deze entity botst met een andere
@@ -104,6 +137,10 @@ protected:
     Position position;
     float speed;
     float collisionRadius = 0.05f;  // Default waarde, wordt overschreven in World::parseMap
+
+private:
+    EntityRegistry* registry = nullptr;  // Non-owning: factory/World houden de registry in leven
+    EntityHandle handle;
 };
 
 } // namespace pacman
\ No newline at end of file
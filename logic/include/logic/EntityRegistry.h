@@ -0,0 +1,105 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace pacman {
+
+class EntityModel;
+
+/**
+ * @brief Generational handle naar een entity in de EntityRegistry
+ *
+ * index = slot in de registry, generation = versie van dat slot. Wordt een
+ * entity verwijderd, dan stijgt de generation van zijn slot: oude handles
+ * resolven daarna naar nullptr, ook als het slot al hergebruikt is.
+ */
+struct EntityHandle {
+    static constexpr std::uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+
+    std::uint32_t index = INVALID_INDEX;
+    std::uint32_t generation = 0;
+
+    bool isValid() const { return index != INVALID_INDEX; }
+
+    bool operator==(const EntityHandle& other) const {
+        return index == other.index && generation == other.generation;
+    }
+    bool operator!=(const EntityHandle& other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Slot map van alle Models van een level (handle → EntityModel*)
+ *
+ * === DOEL ===
+ * Views hielden een EntityModel& vast: werd de World eerst vernietigd, dan
+ * wezen alle Views naar vrijgegeven geheugen (teardown volgorde manueel
+ * bewaakt in ~LevelState). Met een handle:
+ * - get() is een index + generation vergelijking (geen hashing)
+ * - Een verwijderde entity geeft nullptr i.p.v. een dangling pointer
+ * - Een entity mag verhuizen (pool compaction, herallocatie van een vector):
+ *   relocate() past enkel het slot aan, handles blijven geldig
+ *
+ * === LIFETIME ===
+ * - EntityModel::registerIn() voegt de entity toe (AbstractFactory doet dit
+ *   voor elk Model), ~EntityModel() verwijdert hem weer
+ * - Gedeeld via shared_ptr door factory, World en Views: de registry leeft
+ *   tot de laatste van die drie weg is
+ *
+ * Niet thread-safe: één registry per World.
+ */
+class EntityRegistry {
+public:
+    /**
+     * @brief Registreer entity in een vrij slot (LIFO hergebruik)
+     * @return Handle met de huidige generation van het slot
+     */
+    EntityHandle add(EntityModel& entity);
+
+    /**
+     * @brief Maak slot vrij, alle handles ernaar worden stale
+     *
+     * Stale of ongeldige handles worden genegeerd.
+     */
+    void remove(EntityHandle handle);
+
+    /**
+     * @brief Entity voor handle, nullptr als de handle stale of ongeldig is
+     */
+    EntityModel* get(EntityHandle handle) const {
+        if (handle.index >= slots.size()) return nullptr;
+        const Slot& slot = slots[handle.index];
+        return slot.generation == handle.generation ? slot.entity : nullptr;
+    }
+
+    /**
+     * @brief Getypeerde get (caller kent het type, zoals de Views)
+     */
+    template <typename T>
+    T* get(EntityHandle handle) const {
+        return static_cast<T*>(get(handle));
+    }
+
+    bool contains(EntityHandle handle) const { return get(handle) != nullptr; }
+
+    /**
+     * @brief Entity is verhuisd (move in een pool): slot wijst voortaan naar entity
+     */
+    void relocate(EntityHandle handle, EntityModel& entity);
+
+    std::size_t size() const { return liveCount; }
+    std::size_t getSlotCount() const { return slots.size(); }
+
+private:
+    struct Slot {
+        EntityModel* entity = nullptr;
+        std::uint32_t generation = 1;  // 1: default EntityHandle (generation 0) matcht nooit
+        std::uint32_t nextFree = EntityHandle::INVALID_INDEX;
+    };
+
+    std::vector<Slot> slots;
+    std::uint32_t freeHead = EntityHandle::INVALID_INDEX;
+    std::size_t liveCount = 0;
+};
+
+} // namespace pacman
@@ -0,0 +1,131 @@
+#pragma once
+#include "logic/TileLattice.h"
+#include "logic/utils/Position.h"
+#include "logic/utils/Types.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace pacman {
+
+class World;
+class Ghost;
+enum class GhostState;
+
+/**
+ * @brief Batched ghost update - alle ghost state in parallelle arrays (SoA)
+ *
+ * === DOEL ===
+ * Voorheen was elke Ghost een los heap object met eigen update(): virtual
+ * chooseDirection, 2x wouldCollideWithWall en een event, ghost per ghost.
+ * GhostSystem houdt posities, directions, speeds, timers en states van ALLE
+ * ghosts in contiguous arrays en update ze in één pass per fase.
+ *
+ * === UPDATE FASES (update()) ===
+ * 1. Timers: scared/spawn timers aftellen (branchless, vectorizable)
+ * 2. Transitions: scared → normaal, spawn verlaten (+ GHOST_STATE_CHANGED)
+ * 3. Movement stap: speed * deltaTime per ghost (vectorizable)
+ * 4. Per ghost: decision enkel op een intersection (personality via
+ *    Ghost::chooseDirection, scared ghosts vluchten), daarna wall collision,
+ *    door passage, wraparound, facade sync en ENTITY_UPDATED
+ *
+ * In MovementMode::TILE_LATTICE gebruikt fase 4 integer lattice posities:
+ * decisions vallen op tile centers, walls en door zijn tabel lookups
+ * (TileLattice). Posities die extern gezet worden (reset, respawn) worden
+ * bij de volgende tick op een tile center gesnapt.
+ *
+ * Fase 4 loopt in ghost volgorde zodat Random draws (OrangeGhost, wall
+ * collisions) in dezelfde volgorde gebeuren als bij de vroegere per-ghost
+ * Ghost::update(): met dezelfde seed is het gedrag identiek.
+ *
+ * === FACADES ===
+ * Ghost (en subklassen) registreert zichzelf bij constructie en leest/schrijft
+ * zijn state via zijn slot. Views blijven Ghost observeren zoals voorheen.
+ * Slots zijn niet stabiel: remove() verplaatst de laatste ghost naar het gat.
+ */
+class GhostSystem {
+public:
+    explicit GhostSystem(World& world);
+
+    GhostSystem(const GhostSystem&) = delete;
+    GhostSystem& operator=(const GhostSystem&) = delete;
+
+    /**
+     * @brief Update alle ghosts één tick (fases 1-4)
+     * @param deltaTime Tijd sinds laatste frame (seconden)
+     */
+    void update(float deltaTime);
+
+    /**
+     * @brief Update enkel ghosts in slots [begin, end)
+     */
+    void updateRange(std::size_t begin, std::size_t end, float deltaTime);
+
+    std::size_t size() const { return facades.size(); }
+
+    // === Registratie (door Ghost constructor/destructor) ===
+    std::size_t add(Ghost* facade, const Position& spawnPos, float spawnDelay);
+    void remove(std::size_t slot);
+
+    // === Per-slot AI queries (gebruikt door Ghost facades) ===
+    bool isAtIntersection(std::size_t slot) const;
+    std::vector<Direction> getViableDirections(std::size_t slot) const;
+    Direction getBestDirectionToTarget(std::size_t slot, const Position& target, bool maximize) const;
+
+    // === Per-slot commands ===
+    void enterScaredMode(std::size_t slot, float duration);
+    void respawn(std::size_t slot);
+    void reset(std::size_t slot);
+    void setPosition(std::size_t slot, const Position& pos);
+    void setSpeed(std::size_t slot, float speed);
+
+private:
+    friend class Ghost;
+
+    World& world;
+
+    // === Hot state (per ghost) ===
+    std::vector<float> posX;
+    std::vector<float> posY;
+    std::vector<Direction> directions;
+    std::vector<float> speeds;
+    std::vector<float> normalSpeeds;
+    std::vector<float> radii;
+    std::vector<float> scaredTimers;
+    std::vector<float> spawnTimers;
+    std::vector<GhostState> states;
+    std::vector<GhostState> previousStates;
+    std::vector<std::uint8_t> passedDoor;
+    std::vector<LatticePosition> latticePositions;  // Enkel in TILE_LATTICE mode
+    std::vector<std::int64_t> latticeCarries;       // Rest van de integer stap (microseconden * sub-tiles)
+
+    // === Cold state ===
+    std::vector<float> spawnX;
+    std::vector<float> spawnY;
+    std::vector<float> initialSpawnDelays;
+    std::vector<Ghost*> facades;
+
+    // === Scratch (per update) ===
+    std::vector<std::uint8_t> inSpawn;
+    std::vector<float> steps;  // speed * deltaTime (0 in spawn)
+
+    Position positionOf(std::size_t slot) const { return Position(posX[slot], posY[slot]); }
+
+    bool onLattice() const;
+
+    /**
+     * @brief Mag ghost in slot in dir bewegen (float test of lattice lookup)
+     */
+    bool canMove(std::size_t slot, Direction dir) const;
+
+    void moveContinuous(std::size_t slot);
+    void moveOnLattice(std::size_t slot, std::int64_t micros);
+    void decide(std::size_t slot);
+
+    void handleWallCollision(std::size_t slot);
+    void wrapAround(std::size_t slot);
+    void syncFacade(std::size_t slot);
+    void notifyStateChanged(std::size_t slot);
+};
+
+} // namespace pacman
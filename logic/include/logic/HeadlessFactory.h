@@ -0,0 +1,30 @@
+#pragma once
+#include "logic/AbstractFactory.h"
+
+namespace pacman {
+
+/**
+ * @brief AbstractFactory zonder views - enkel Models
+ *
+ * === DOEL ===
+ * World draaien zonder representation laag (geen SFML):
+ * - Benchmarks (PacManBench)
+ * - Headless simulaties / batch runs
+ *
+ * Zelfde ghost mapping als ConcreteFactory:
+ * RED → RedGhost, PINK → PinkGhost, BLUE → BlueGhost, ORANGE → OrangeGhost.
+ * Er worden geen observers geattached (World attacht zelf Score).
+ */
+class HeadlessFactory : public AbstractFactory {
+public:
+    HeadlessFactory() = default;
+    ~HeadlessFactory() override = default;
+
+    EntityPtr<PacMan> createPacMan(const Position& pos) override;
+    EntityPtr<Coin> createCoin(const Position& pos) override;
+    EntityPtr<Fruit> createFruit(const Position& pos) override;
+    EntityPtr<Wall> createWall(const Position& pos) override;
+    EntityPtr<Ghost> createGhost(World& world, const Position& pos, GhostColor color) override;
+};
+
+} // namespace pacman
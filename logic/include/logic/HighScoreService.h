@@ -0,0 +1,132 @@
+#pragma once
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace pacman {
+
+/**
+ * @brief Highscore entry (naam + score)
+ */
+struct HighScoreEntry {
+    std::string name;
+    int score;
+
+    HighScoreEntry() : name("---"), score(0) {}
+    HighScoreEntry(const std::string& n, int s) : name(n), score(s) {}
+};
+
+/**
+ * @brief Process-wide leaderboard (top 5) - één disk read, async writes
+ *
+ * === WAAROM ===
+ * Elke Score las highscores.txt in zijn constructor: elke World, elk menu
+ * bezoek en elke game over parste de file opnieuw. Nu leest deze service de
+ * file één keer (load(), lazy bij de eerste query) en beantwoordt alles uit
+ * geheugen. Score doet enkel nog punten.
+ *
+ * === WRITES ===
+ * submit() past de tabel in geheugen meteen aan en wekt een writer thread.
+ * Die schrijft de laatste stand (meerdere submits kort na elkaar = één write)
+ * naar een tmp file en rename't die over de echte file: een crash midden in
+ * een write laat de oude file heel. flush() wacht tot alles op disk staat;
+ * de destructor flusht ook.
+ *
+ * === FILE FORMAT ===
+ * - "name,score" per regel, gesorteerd descending
+ * - Ontbrekende of kapotte file = lege tabel (waarschuwing, geen exception)
+ * - Aangevuld met "---" entries tot MAX_ENTRIES
+ *
+ * === THREAD SAFETY ===
+ * Alle publieke methodes nemen de mutex: StatePreparer mag load() op zijn
+ * worker aanroepen terwijl de main thread queries doet.
+ *
+ * Usage:
+ * ```cpp
+ * auto& highScores = HighScoreService::getInstance();
+ * if (highScores.isHighScore(finalScore)) {
+ *     highScores.submit(playerName, finalScore);  // Keert meteen terug
+ * }
+ * ```
+ */
+class HighScoreService {
+public:
+    static constexpr std::size_t MAX_ENTRIES = 5;
+    static constexpr const char* DEFAULT_FILE = "../resources/highscores/highscores.txt";
+
+    /**
+     * @brief Verkrijg singleton instance (Meyers Singleton)
+     */
+    static HighScoreService& getInstance() {
+        static HighScoreService instance;
+        return instance;
+    }
+
+    // Delete copy/move (singleton)
+    HighScoreService(const HighScoreService&) = delete;
+    HighScoreService& operator=(const HighScoreService&) = delete;
+    HighScoreService(HighScoreService&&) = delete;
+    HighScoreService& operator=(HighScoreService&&) = delete;
+
+    /**
+     * @brief Gebruik een andere file (vóór de eerste query, bv. tools)
+     */
+    void setFile(const std::string& filename);
+
+    /**
+     * @brief Lees de file als dat nog niet gebeurd is (idempotent)
+     */
+    void load();
+
+    /**
+     * @brief Top MAX_ENTRIES, descending (kopie)
+     */
+    std::vector<HighScoreEntry> getHighScores();
+
+    /**
+     * @brief Check of score highscore is
+     * @return true als score > laatste plaats OF minder dan MAX_ENTRIES entries
+     */
+    bool isHighScore(int score);
+
+    /**
+     * @brief Voeg entry toe (geheugen meteen, disk async)
+     *
+     * Voegt toe, sorteert, houdt top MAX_ENTRIES.
+     */
+    void submit(const std::string& playerName, int score);
+
+    /**
+     * @brief Wacht tot de laatste submit op disk staat
+     */
+    void flush();
+
+private:
+    HighScoreService() = default;
+    ~HighScoreService();
+
+    std::mutex mutex;
+    std::condition_variable writeRequested;
+    std::condition_variable writeCompleted;
+
+    std::string filename = DEFAULT_FILE;
+    std::vector<HighScoreEntry> entries;
+    bool loaded = false;
+
+    // Writer (lazy gestart bij de eerste submit)
+    std::thread writer;
+    std::uint64_t version = 0;         // +1 per submit
+    std::uint64_t writtenVersion = 0;  // Laatste versie op disk
+    bool stopping = false;
+
+    void loadLocked();
+    void writerLoop();
+
+    static std::vector<HighScoreEntry> readFile(const std::string& filename);
+    static bool writeFile(const std::string& filename, const std::vector<HighScoreEntry>& entries);
+};
+
+} // namespace pacman
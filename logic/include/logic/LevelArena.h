@@ -0,0 +1,112 @@
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+namespace pacman {
+
+/**
+ * @brief Per-level monotonic arena voor Models en Views
+ *
+ * === DOEL ===
+ * Een level laden maakte honderden losse heap allocaties (make_unique per
+ * wall, coin, ... en per view) die bij het einde van het level één voor één
+ * werden vrijgegeven. De arena geeft geheugen uit een paar grote blokken
+ * (std::pmr::monotonic_buffer_resource): allocatie is een pointer bump,
+ * entities van één level liggen dicht bij elkaar, en elke World/factory
+ * combinatie heeft een eigen arena (geen gedeelde heap lock bij parallelle worlds).
+ *
+ * === LIFETIME ===
+ * - Objecten in de arena worden via EntityPtr vernietigd (enkel destructor)
+ * - Het geheugen komt pas terug bij release() of ~LevelArena()
+ * - De arena moet dus World en factory (Models en Views) outliven
+ * - Herladen in dezelfde arena (World::loadLevel opnieuw) laat het oude
+ *   geheugen staan tot release(): één arena per level
+ *
+ * Niet thread-safe: één arena per World.
+ */
+class LevelArena {
+public:
+    static constexpr std::size_t DEFAULT_INITIAL_SIZE = 64 * 1024;
+
+    explicit LevelArena(std::size_t initialSize = DEFAULT_INITIAL_SIZE);
+
+    LevelArena(const LevelArena&) = delete;
+    LevelArena& operator=(const LevelArena&) = delete;
+
+    /**
+     * @brief Construeer T in de arena
+     */
+    template <typename T, typename... Args>
+    T* construct(Args&&... args) {
+        void* memory = allocate(sizeof(T), alignof(T));
+        return ::new (memory) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Geef al het geheugen in één keer vrij
+     *
+     * Alle objecten in de arena moeten al vernietigd zijn.
+     */
+    void release();
+
+    std::size_t getBytesAllocated() const { return bytesAllocated; }
+    std::size_t getAllocationCount() const { return allocationCount; }
+
+    std::pmr::memory_resource* getResource() { return &resource; }
+
+private:
+    std::pmr::monotonic_buffer_resource resource;
+    std::size_t bytesAllocated = 0;
+    std::size_t allocationCount = 0;
+
+    void* allocate(std::size_t size, std::size_t alignment);
+};
+
+/**
+ * @brief Deleter voor EntityPtr: heap → delete, arena → enkel destructor
+ */
+struct EntityDeleter {
+    bool inArena = false;
+
+    template <typename T>
+    void operator()(T* ptr) const {
+        if (!ptr) return;
+        if (inArena) {
+            ptr->~T();  // Virtual destructor: juiste subklasse
+        } else {
+            delete ptr;
+        }
+    }
+};
+
+/**
+ * @brief Owning pointer naar een Model of View (heap of LevelArena)
+ *
+ * Converteert zoals unique_ptr (EntityPtr<RedGhost> → EntityPtr<Ghost>).
+ */
+template <typename T>
+using EntityPtr = std::unique_ptr<T, EntityDeleter>;
+
+/**
+ * @brief Maak entity in arena, of op de heap als arena nullptr is
+ */
+template <typename T, typename... Args>
+EntityPtr<T> makeEntity(LevelArena* arena, Args&&... args) {
+    if (!arena) {
+        return EntityPtr<T>(new T(std::forward<Args>(args)...));
+    }
+    return EntityPtr<T>(arena->construct<T>(std::forward<Args>(args)...), EntityDeleter{true});
+}
+
+/**
+ * @brief Neem een gewone unique_ptr over (heap object)
+ */
+template <typename T>
+EntityPtr<T> adoptEntity(std::unique_ptr<T> ptr) {
+    return EntityPtr<T>(ptr.release());
+}
+
+} // namespace pacman
@@ -0,0 +1,83 @@
+#pragma once
+#include <string>
+#include <vector>
+
+namespace pacman {
+
+/**
+ * @brief Parameters voor procedurele map generatie
+ *
+ * rows/cols worden geclamped naar [MIN_SIZE, MAX_SIZE].
+ */
+struct MapGeneratorConfig {
+    int rows = 21;
+    int cols = 21;
+    unsigned int seed = 1;
+
+    int ghostCount = 4;          // Ghost spawns in ghost house (r, i, b, o, daarna 'g'), max maxGhosts(cols)
+    float fruitDensity = 0.01f;  // Kans dat een corridor tile fruit wordt ipv coin
+    float braidFactor = 1.0f;    // Kans dat een dead end een lus wordt (1.0 = geen dead ends)
+    bool door = true;            // Deur boven ghost house
+
+    static constexpr int MIN_SIZE = 11;
+    static constexpr int MAX_SIZE = 1000;
+};
+
+/**
+ * @brief Procedurele maze generator voor stress/scaling tests
+ *
+ * === DOEL ===
+ * De meegeleverde maps zijn max 20 rijen, wat het O(walls) en O(coins)
+ * gedrag van World verbergt. MapGenerator maakt mazes tot 1000x1000 tiles
+ * in exact het text formaat van World::parseMap (zie World::loadLevel).
+ *
+ * === ALGORITME ===
+ * 1. Alles muur, cellen op oneven (row, col)
+ * 2. Iteratieve DFS (recursive backtracker) carved een perfecte maze
+ *    (iteratief: geen stack overflow bij 1000x1000)
+ * 3. Braiding: dead ends krijgen met kans braidFactor een extra opening
+ *    (Pac-Man mazes hebben lussen, geen doodlopende gangen)
+ * 4. Ghost house in het centrum (zoals map_big.txt):
+ *    ```
+ *     xxxdxxx
+ *     xri#obx
+ *     xxxxxxx
+ *    ```
+ *    met een corridor ring errond zodat de maze verbonden blijft.
+ *    Meer dan 4 ghosts: breder house, extra spawns als 'g'
+ * 5. PacMan spawn onder het ghost house
+ * 6. Flood fill vanaf PacMan: onbereikbare tiles worden muur
+ *    (anders is het level nooit compleet)
+ * 7. Corridors: coin, of fruit met kans fruitDensity (min. 1 fruit)
+ *
+ * Deterministisch: zelfde config (incl. seed) → zelfde map.
+ * Gebruikt een eigen generator, NIET de Random singleton.
+ */
+class MapGenerator {
+public:
+    explicit MapGenerator(const MapGeneratorConfig& config);
+
+    /**
+     * @brief Genereer map
+     * @return Rijen in World map formaat (alle rijen even lang)
+     */
+    std::vector<std::string> generate() const;
+
+    /**
+     * @brief Schrijf map naar text file
+     * @throws std::runtime_error als file niet geopend kan worden
+     */
+    static void writeToFile(const std::vector<std::string>& mapData, const std::string& filename);
+
+    const MapGeneratorConfig& getConfig() const { return config; }
+
+    /**
+     * @brief Max aantal ghosts dat in het ghost house past voor deze breedte
+     */
+    static int maxGhosts(int cols);
+
+private:
+    MapGeneratorConfig config;
+};
+
+} // namespace pacman
@@ -0,0 +1,50 @@
+#pragma once
+#include "logic/entities/Ghost.h"
+#include "logic/utils/Position.h"
+#include "logic/utils/Types.h"
+#include <cstdint>
+#include <vector>
+
+namespace pacman {
+
+/**
+ * @brief Onveranderlijke kopie van alles wat een frame nodig heeft
+ *
+ * Gevuld door World::captureSnapshot() op de simulation thread, gelezen door
+ * de render thread (via TripleBuffer). Enkel plain data: de renderer raakt de
+ * World niet aan zolang de simulation thread loopt.
+ *
+ * Statische layout (wall, coin en fruit posities, door) zit NIET in de
+ * snapshot: die verandert niet na loadLevel en wordt vooraf één keer gelezen
+ * (World::getComponents()). coinsCollected/fruitsCollected volgen dezelfde
+ * indices als de component arrays.
+ */
+struct RenderSnapshot {
+    struct GhostSnapshot {
+        Position position;
+        Direction direction = Direction::NONE;
+        GhostState state = GhostState::IN_SPAWN;
+        GhostColor color = GhostColor::RED;
+        float scaredTimeRemaining = 0.0f;
+    };
+
+    std::uint64_t tick = 0;    // Simulation ticks sinds start (0 = nog niets gesimuleerd)
+    float elapsedTime = 0.0f;  // Gespeelde tijd (zonder READY en pauze)
+
+    bool hasPacMan = false;
+    Position pacmanPosition;
+    Direction pacmanDirection = Direction::NONE;
+    int lives = 0;
+    bool deathAnimationPlaying = false;
+
+    std::vector<GhostSnapshot> ghosts;
+    std::vector<std::uint8_t> coinsCollected;
+    std::vector<std::uint8_t> fruitsCollected;
+
+    int score = 0;
+    bool showingReady = false;  // Simulation staat stil voor het READY scherm
+    bool levelComplete = false;
+    bool gameOver = false;
+};
+
+} // namespace pacman
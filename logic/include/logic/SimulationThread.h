@@ -0,0 +1,138 @@
+#pragma once
+#include "logic/RenderSnapshot.h"
+#include "logic/utils/SpscQueue.h"
+#include "logic/utils/TripleBuffer.h"
+#include "logic/utils/Types.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace pacman {
+
+class World;
+
+/**
+ * @brief Input van de render thread naar de simulation thread
+ */
+struct SimulationCommand {
+    enum class Type : std::uint8_t {
+        SET_DIRECTION,  // PacMan::setDirection(direction)
+        PAUSE,          // Geen ticks meer (bv. PausedState bovenop de level)
+        RESUME
+    };
+
+    Type type = Type::SET_DIRECTION;
+    Direction direction = Direction::NONE;
+};
+
+/**
+ * @brief Draait World::update op een eigen thread met een vaste tick
+ *
+ * === DOEL ===
+ * In de single-threaded loop vertraagt een trage window.display() of driver
+ * stall de game logic rechtstreeks. Hier tikt de simulation op zijn eigen
+ * klok; de render thread tekent telkens de laatst gepubliceerde snapshot.
+ *
+ * === DATA FLOW ===
+ * ```
+ * render thread ──SpscQueue<SimulationCommand>──▶ simulation thread
+ *               ◀──TripleBuffer<RenderSnapshot>──
+ * ```
+ * Geen locks: de render thread wacht nooit op een tick en omgekeerd.
+ *
+ * === OWNERSHIP ===
+ * Tussen start() en stop() is de World exclusief van de simulation thread:
+ * de caller leest enkel snapshots (statische layout mag vooraf gelezen worden).
+ * run() zet World::setOwnerThread, stop() geeft hem na join() terug.
+ * De World mag geen Views hebben (HeadlessFactory): observers zouden op de
+ * simulation thread draaien.
+ *
+ * === TIMING ===
+ * - Zelfde READY logica als LevelState: stilstand bij start en na elke death
+ *   animation (world.update(0)), elapsedTime telt dan niet
+ * - Na level complete of game over stopt de simulation (één LEVEL_CLEARED)
+ * - Meer dan MAX_CATCH_UP_TICKS achter: klok resetten i.p.v. inhalen
+ */
+class SimulationThread {
+public:
+    static constexpr float DEFAULT_TICK = 1.0f / 60.0f;
+    static constexpr std::size_t COMMAND_CAPACITY = 64;
+    static constexpr int MAX_CATCH_UP_TICKS = 5;
+
+    /**
+     * @param world Geladen World (loadLevel al gedaan)
+     * @param tickSeconds Vaste simulation stap
+     * @param readyDuration Duur van het READY scherm (seconden)
+     */
+    SimulationThread(World& world, float tickSeconds, float readyDuration);
+    ~SimulationThread();
+
+    SimulationThread(const SimulationThread&) = delete;
+    SimulationThread& operator=(const SimulationThread&) = delete;
+
+    /**
+     * @brief Publiceer de begin snapshot en start de thread
+     */
+    void start();
+
+    /**
+     * @brief Stop en join (idempotent); daarna is de World weer van de caller
+     */
+    void stop();
+
+    bool isRunning() const { return thread.joinable(); }
+
+    /**
+     * @brief Stuur command naar de simulation (render thread)
+     * @return false als de queue vol is (command gedropt)
+     */
+    bool pushCommand(const SimulationCommand& command) { return commands.push(command); }
+
+    /**
+     * @brief Laatste snapshot (render thread), geldig tot de volgende aanroep
+     */
+    const RenderSnapshot& acquireSnapshot();
+
+    // Tick statistieken (atomic: leesbaar vanaf elke thread)
+    std::uint64_t getTickCount() const { return tickCount.load(std::memory_order_relaxed); }
+    std::uint64_t getMaxTickLatenessUs() const { return maxTickLatenessUs.load(std::memory_order_relaxed); }
+    std::uint64_t getClockResets() const { return clockResets.load(std::memory_order_relaxed); }
+
+private:
+    World& world;
+    const float tickSeconds;
+    const float readyDuration;
+
+    std::thread thread;
+    std::atomic<bool> running{false};
+
+    SpscQueue<SimulationCommand, COMMAND_CAPACITY> commands;
+    TripleBuffer<RenderSnapshot> snapshots;
+
+    // Enkel simulation thread (na start())
+    bool paused = false;
+    bool finished = false;
+    bool showingReady = true;
+    bool wasPlayingDeathAnimation = false;
+    float readyTimer = 0.0f;
+    float elapsedTime = 0.0f;
+    std::uint64_t tick = 0;
+
+    std::atomic<std::uint64_t> tickCount{0};
+    std::atomic<std::uint64_t> maxTickLatenessUs{0};
+    std::atomic<std::uint64_t> clockResets{0};
+
+    void run();
+    void drainCommands();
+
+    /**
+     * @brief Eén vaste tick (zelfde volgorde als LevelState::update)
+     * @return false als er niets gesimuleerd is (paused of finished)
+     */
+    bool step();
+
+    void publishSnapshot();
+};
+
+} // namespace pacman
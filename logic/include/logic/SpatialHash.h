@@ -0,0 +1,88 @@
+#pragma once
+#include "logic/EntityModel.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace pacman {
+
+/**
+ * @brief Uniform spatial hash voor bewegende entities (PacMan, ghosts)
+ *
+ * === DOEL ===
+ * Met veel ghosts is "PacMan tegen elke ghost" O(ghosts) per tick en elke
+ * ghost-ghost interactie O(n^2). De hash verdeelt entity centers over
+ * cellen van één tile; een query bekijkt enkel de cellen onder een area.
+ * Kost van een query ~ lokale dichtheid, niet de populatie.
+ *
+ * === LAYOUT ===
+ * - Cel = floor((pos - origin) / cellSize), World gebruikt origin = linkerbovenhoek
+ *   van de map en cellSize = 1 tile (cellen vallen samen met tiles)
+ * - Cellen worden gehasht naar 2^k buckets (k ~ log2(2 * entities)): geheugen
+ *   schaalt met het aantal entities, niet met de map grootte (tot 1000x1000)
+ * - build(): counting sort van de entries per bucket, O(entities + buckets),
+ *   elke tick opnieuw (geen allocaties na de eerste ticks)
+ *
+ * === USAGE ===
+ * ```cpp
+ * hash.clear();
+ * for (...) hash.insert(id, entity->getPosition());
+ * hash.build();
+ * hash.query(area, ids);  // ids van entities met center in een cel onder area
+ * ```
+ * Query resultaten zijn een superset (cel granulariteit): doe zelf de exacte test.
+ */
+class SpatialHash {
+public:
+    /**
+     * @brief Stel grid in (cellen uitgelijnd op origin)
+     * @param originX, originY Hoek van cel (0, 0)
+     * @param cellSize Zijde van een cel (World: tileSize)
+     */
+    void setGrid(float originX, float originY, float cellSize);
+
+    void clear();
+
+    /**
+     * @brief Registreer entity voor de volgende build()
+     * @param id Door caller gekozen id (bv. index in ghosts)
+     */
+    void insert(std::uint32_t id, const Position& pos);
+
+    /**
+     * @brief Sorteer alle insert()s in buckets (maakt query() geldig)
+     */
+    void build();
+
+    /**
+     * @brief Ids van entities met center in een cel die area overlapt
+     * @param hits Output (wordt NIET geleegd), volgorde ongedefinieerd
+     */
+    void query(const BoundingBox& area, std::vector<std::uint32_t>& hits) const;
+
+    std::size_t size() const { return entries.size(); }
+    std::size_t getBucketCount() const { return bucketStart.empty() ? 0 : bucketStart.size() - 1; }
+
+private:
+    struct Entry {
+        std::uint32_t id;
+        std::int32_t cellX;
+        std::int32_t cellY;
+    };
+
+    float originX = 0.0f;
+    float originY = 0.0f;
+    float cellSize = 1.0f;
+    float inverseCellSize = 1.0f;
+
+    std::vector<Entry> staged;                // insert() volgorde
+    std::vector<Entry> entries;               // Gesorteerd per bucket
+    std::vector<std::uint32_t> bucketStart;   // entries[bucketStart[b], bucketStart[b+1])
+    std::uint32_t bucketMask = 0;
+    std::vector<std::uint32_t> scratchCursor; // build(): schrijfpositie per bucket
+
+    std::int32_t cellOf(float value, float origin) const;
+    std::uint32_t bucketOf(std::int32_t cellX, std::int32_t cellY) const;
+};
+
+} // namespace pacman
@@ -0,0 +1,183 @@
+#pragma once
+#include "logic/utils/Position.h"
+#include "logic/utils/Types.h"
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace pacman {
+
+/**
+ * @brief Physics mode van World
+ */
+enum class MovementMode {
+    CONTINUOUS,    // Float posities, AABB/swept collision (default)
+    TILE_LATTICE   // Fixed-point tile rooster, turns enkel op tile centers
+};
+
+/**
+ * @brief Positie op het tile rooster in sub-tile eenheden
+ *
+ * Tile (row, col) beslaat x in [col * SUBTILES, (col + 1) * SUBTILES),
+ * center op col * SUBTILES + CENTER (idem voor y/row).
+ */
+struct LatticePosition {
+    std::int32_t x = 0;
+    std::int32_t y = 0;
+
+    bool operator==(const LatticePosition& other) const { return x == other.x && y == other.y; }
+};
+
+/**
+ * @brief Tile-aligned integer movement (MovementMode::TILE_LATTICE)
+ *
+ * === DOEL ===
+ * In CONTINUOUS mode bewegen entities in float world units met radii die op
+ * tile fracties getuned zijn (0.4555, 0.45). In lattice mode:
+ * - Posities zijn integers (SUBTILES stappen per tile)
+ * - Snelheden worden sub-tiles per seconde, deltaTime microseconden: de stap
+ *   per tick is integer rekenwerk met een carry (geen drift)
+ * - Entities bewegen enkel langs de as van hun tile en draaien enkel op een
+ *   tile center (of keren om)
+ * - Collision is een tabel lookup: mag de buur tile betreden worden?
+ *
+ * Dezelfde input (seed, deltaTimes) geeft dus bit-exact dezelfde posities,
+ * onafhankelijk van compiler, platform of FMA contractie.
+ *
+ * === WRAPAROUND ===
+ * Buiten de map links/rechts → andere kant (tunnel rijen). Boven/onder is
+ * altijd geblokkeerd.
+ */
+class TileLattice {
+public:
+    static constexpr std::int32_t SUBTILES = 256;
+    static constexpr std::int32_t CENTER = SUBTILES / 2;
+
+    /**
+     * @brief Bouw de lookup tabel
+     * @param wallTiles Per tile >= 0 voor wall, -1 voor vrij (World::wallTiles)
+     * @param doorRow, doorCol Door tile, of -1 als de map geen door heeft
+     */
+    void build(int rows, int cols, const std::vector<int>& wallTiles, int doorRow, int doorCol);
+
+    bool empty() const { return cells.empty(); }
+
+    /**
+     * @brief Mag tile (row, col) betreden worden?
+     * @param doorBlocks true voor PacMan en ghosts die al door de door zijn
+     */
+    bool isOpen(int row, int col, bool doorBlocks) const;
+
+    /**
+     * @brief Mag de entity vanuit zijn huidige tile in dir naar de buur tile?
+     */
+    bool canEnter(const LatticePosition& pos, Direction dir, bool doorBlocks) const;
+
+    /**
+     * @brief Aantal open buur tiles (junction: >= 3)
+     */
+    int countExits(const LatticePosition& pos, bool doorBlocks) const;
+
+    bool isAtCenter(const LatticePosition& pos) const;
+    int rowOf(const LatticePosition& pos) const { return floorDiv(pos.y); }
+    int colOf(const LatticePosition& pos) const { return floorDiv(pos.x); }
+
+    /**
+     * @brief Dichtstbijzijnde tile center (bv. na een reset of respawn)
+     */
+    LatticePosition snap(const Position& worldPos) const;
+
+    /**
+     * @brief Zelfde punt in sub-tile eenheden (afgerond, niet gesnapt)
+     */
+    LatticePosition toLattice(const Position& worldPos) const;
+
+    Position toWorld(const LatticePosition& pos) const;
+
+    /**
+     * @brief World speed (units/s) → sub-tiles per seconde (afgerond)
+     */
+    std::int64_t subtilesPerSecond(float speed) const;
+
+    /**
+     * @brief Integer stap voor deze tick
+     * @param micros deltaTime in microseconden
+     * @param carry Rest van vorige ticks (per entity bewaren)
+     */
+    static std::int32_t stepFor(std::int64_t subtilesPerSecond, std::int64_t micros, std::int64_t& carry);
+
+    static std::int64_t toMicros(float deltaTime);
+
+    /**
+     * @brief Beweeg tot distance sub-tiles langs dir
+     * @param decideAtCenter Op elk tile center: Direction(const LatticePosition&, Direction current).
+     *        Geeft de nieuwe direction; de entity stopt als die tile niet open is.
+     *
+     * Staat de entity naast de as van dir (bv. direction extern gewijzigd),
+     * dan beweegt hij eerst terug naar het center van zijn tile.
+     */
+    template <typename Decide>
+    void advance(LatticePosition& pos, Direction& dir, std::int32_t distance, bool doorBlocks,
+                 Decide&& decideAtCenter) const;
+
+private:
+    enum Cell : std::uint8_t {
+        OPEN = 0,
+        WALL = 1,
+        DOOR = 2
+    };
+
+    int rows = 0;
+    int cols = 0;
+    float worldWidth = 1.0f;
+    float tileSize = 1.0f;
+    std::vector<std::uint8_t> cells;
+
+    static int floorDiv(std::int32_t value);
+    void wrap(LatticePosition& pos) const;
+    static int stepX(Direction dir);
+    static int stepY(Direction dir);
+};
+
+template <typename Decide>
+void TileLattice::advance(LatticePosition& pos, Direction& dir, std::int32_t distance, bool doorBlocks,
+                          Decide&& decideAtCenter) const {
+    while (distance > 0) {
+        std::int32_t offsetX = pos.x - (colOf(pos) * SUBTILES + CENTER);
+        std::int32_t offsetY = pos.y - (rowOf(pos) * SUBTILES + CENTER);
+
+        if (offsetX == 0 && offsetY == 0) {
+            dir = decideAtCenter(pos, dir);
+            if (dir == Direction::NONE || !canEnter(pos, dir, doorBlocks)) return;
+        }
+
+        int dx = stepX(dir);
+        int dy = stepY(dir);
+
+        // Naast de as van dir: eerst terug naar het center van deze tile
+        if (dx != 0 && offsetY != 0) {
+            std::int32_t move = std::min(distance, offsetY < 0 ? -offsetY : offsetY);
+            pos.y += offsetY < 0 ? move : -move;
+            distance -= move;
+            continue;
+        }
+        if (dy != 0 && offsetX != 0) {
+            std::int32_t move = std::min(distance, offsetX < 0 ? -offsetX : offsetX);
+            pos.x += offsetX < 0 ? move : -move;
+            distance -= move;
+            continue;
+        }
+
+        // Tot het volgende center langs dir (SUBTILES vanaf een center)
+        std::int32_t offset = dx != 0 ? offsetX * dx : offsetY * dy;  // > 0: voorbij het center
+        std::int32_t toNext = offset >= 0 ? SUBTILES - offset : -offset;
+        std::int32_t move = std::min(distance, toNext);
+
+        pos.x += dx * move;
+        pos.y += dy * move;
+        distance -= move;
+        wrap(pos);
+    }
+}
+
+} // namespace pacman
@@ -0,0 +1,95 @@
+#pragma once
+#include "logic/EntityModel.h"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace pacman {
+
+/**
+ * @brief Tile-bucketed AABB index voor visibility culling (render pass)
+ *
+ * === DOEL ===
+ * LevelState tekende elke View, ook als de camera maar een deel van de map
+ * toont. Statische entries (walls, coins, fruits, door) registreren hun world
+ * AABB één keer; een query levert enkel de ids onder de camera rechthoek.
+ * Kost van een query ~ aantal tiles + entries op het scherm, niet de map grootte.
+ *
+ * === LAYOUT ===
+ * - Vast grid van cols x rows tiles vanaf (originX, originY), één bucket per tile
+ *   (map tiles: World/Camera coordinaten, tileSize = 2 / mapRows)
+ * - Een AABB komt in elke tile die hij raakt (geclamped aan het grid)
+ * - build(): counting sort naar buckets (zelfde CSR layout als SpatialHash)
+ *
+ * === USAGE ===
+ * ```cpp
+ * index.setGrid(-worldWidth, -1.0f, tileSize, cols, rows);
+ * for (...) index.insert(id, bounds);   // ids dicht: 0..n-1
+ * index.build();
+ * index.query(camera.getVisibleWorldBounds(), ids);  // uniek, tile volgorde
+ * ```
+ * Resultaten zijn NIET gesorteerd (sorteren kostte meer dan de hele lookup):
+ * enkel entries waarvan de onderlinge teken volgorde niet uitmaakt (tiles die
+ * elkaar niet overlappen) horen in de index.
+ */
+class VisibilityIndex {
+public:
+    /**
+     * @brief Stel grid in (wist alle entries)
+     * @param originX, originY Linkerbovenhoek van tile (0, 0)
+     * @param tileSize Zijde van een tile
+     * @param cols, rows Aantal tiles
+     */
+    void setGrid(float originX, float originY, float tileSize, int cols, int rows);
+
+    void clear();
+
+    /**
+     * @brief Registreer AABB voor de volgende build()
+     * @param id Door caller gekozen id (dicht gehouden: bepaalt geheugen)
+     */
+    void insert(std::uint32_t id, const BoundingBox& bounds);
+
+    /**
+     * @brief Verdeel alle insert()s over de tile buckets (maakt query() geldig)
+     */
+    void build();
+
+    /**
+     * @brief Ids waarvan de AABB area overlapt
+     * @param ids Output (wordt geleegd), uniek, in tile volgorde (rij per rij)
+     */
+    void query(const BoundingBox& area, std::vector<std::uint32_t>& ids) const;
+
+    std::size_t size() const { return bounds.size(); }
+    std::size_t getTileCount() const { return static_cast<std::size_t>(cols) * static_cast<std::size_t>(rows); }
+
+private:
+    struct Staged {
+        std::uint32_t id;
+        BoundingBox bounds;
+    };
+
+    float originX = 0.0f;
+    float originY = 0.0f;
+    float inverseTileSize = 1.0f;
+    int cols = 0;
+    int rows = 0;
+
+    std::vector<Staged> staged;
+    std::vector<BoundingBox> bounds;           // Per id (exacte test na de tile lookup)
+    std::vector<std::uint8_t> inserted;        // Per id: 0 = gat in de ids (nooit geïnsert)
+    std::vector<std::uint32_t> entries;        // Ids gesorteerd per tile
+    std::vector<std::uint32_t> tileStart;      // entries[tileStart[t], tileStart[t+1])
+
+    // query(): id al gezien in deze query (stamp i.p.v. wissen per query)
+    mutable std::vector<std::uint32_t> seenStamp;
+    mutable std::uint32_t currentStamp = 0;
+
+    int tileColumn(float x) const;
+    int tileRow(float y) const;
+    int lastTileColumn(float right) const;  // Exclusieve rand (insert)
+    int lastTileRow(float bottom) const;
+};
+
+} // namespace pacman
@@ -6,18 +6,57 @@
 #include "logic/entities/Fruit.h"
 #include "logic/entities/Wall.h"
 #include "logic/AbstractFactory.h"
+#include "logic/Components.h"
 #include "logic/Score.h"
+#include "logic/GhostSystem.h"
+#include "logic/AabbBatch.h"
+#include "logic/SpatialHash.h"
+#include "logic/TileLattice.h"
+#include <atomic>
+#include <cstdint>
+#include <thread>
 #include <vector>
 #include <memory>
 #include <string>
 
 namespace pacman {
 
+struct RenderSnapshot;  // Ghost.h include World.h: geen include cycle
+
 struct MapDimensions {
     int rows;
     int cols;
 };
 
+/**
+ * @brief Ghost roster - level config voor ghost personalities
+ *
+ * Ghosts komen uit de map: elke 'r'/'i'/'b'/'o' tile spawnt een ghost met die
+ * personality (meerdere per kleur toegestaan). 'g' tiles krijgen cyclisch een
+ * personality uit de roster.
+ */
+struct GhostRoster {
+    std::vector<GhostColor> personalities;  // Cyclus voor 'g' tiles (leeg = RED, PINK, BLUE, ORANGE)
+    float sameColorStagger = 1.0f;          // Extra spawn delay (s) per volgende ghost van dezelfde kleur
+};
+
+/**
+ * @brief Samengevoegde wall rechthoek (collision), in world coordinaten
+ *
+ * Aaneengesloten wall tiles vormen één rechthoek: de unie van hun bounding
+ * boxes (left/top/right/bottom exact overgenomen van de tile boxes).
+ */
+struct WallRect {
+    float left;
+    float top;
+    float right;
+    float bottom;
+    int firstRow;
+    int firstCol;
+    int rows;   // Hoogte in tiles
+    int cols;   // Breedte in tiles
+};
+
 /**
  * @brief Centrale game controller - beheert alle entities en game state
  *
@@ -36,6 +75,7 @@ struct MapDimensions {
  * === COLLISION SYSTEEM ===
  * - Axis-aligned bounding boxes (AABB)
  * - Split X/Y movement (voorkomt diagonal wall clipping)
+ * - Swept movement langs de as (geen tunneling bij grote deltaTime)
  * - Corner smoothing (voorkomt vastlopen bij schuin tegen muur)
  * - Door mechanisme (ghosts kunnen 1x door, daarna geblokkeerd)
  *
@@ -70,8 +110,8 @@ public:
      * Update volgorde:
      * 1. Death animation (als actief, skip rest)
      * 2. PacMan movement + collision
-     * 3. Ghost movement + AI
-     * 4. Wraparound check (tunnel edges)
+     * 3. Ghost movement + AI (batched via GhostSystem, incl. wraparound)
+     * 4. Wraparound check PacMan (tunnel edges)
      * 5. Entity updates (notify observers)
      * 6. Collision detection
      */
@@ -90,19 +130,97 @@ public:
      * - 'i' / 'I': Pink ghost spawn
      * - 'b' / 'B': Blue ghost spawn
      * - 'o' / 'O': Orange ghost spawn
+     * - 'g' / 'G': Ghost spawn, personality uit GhostRoster
      * - 'd' / 'D': Door (ghost spawn exit)
+     *
+     * Ghost tiles mogen meermaals voorkomen (1 ghost per tile).
      */
     void loadLevel(const std::string& mapFile);
 
+    /**
+     * @brief Laad level vanuit map data in geheugen (zelfde formaat als loadLevel)
+     * @param mapData Rijen van de map (e.g., uit MapGenerator::generate())
+     * @throws std::runtime_error als mapData leeg is
+     */
+    void loadLevelFromData(const std::vector<std::string>& mapData);
+
+    /**
+     * @brief Lees een map file naar rijen (niet-lege lijnen), zonder World
+     *
+     * Raakt geen World state aan: veilig op een andere thread (StatePreparer
+     * leest de map van het volgende level vooraf).
+     * @throws std::runtime_error als de file niet open kan of leeg is
+     */
+    static std::vector<std::string> readMapFile(const std::string& mapFile);
+
     void nextLevel();
     void reset();
 
+    /**
+     * @brief Stel ghost roster in (voor loadLevel aanroepen)
+     */
+    void setGhostRoster(const GhostRoster& roster) { ghostRoster = roster; }
+    const GhostRoster& getGhostRoster() const { return ghostRoster; }
+
+    /**
+     * @brief Kies storage voor walls, coins en fruits (voor loadLevel aanroepen)
+     *
+     * COMPONENTS: geen Models of Views via de factory, enkel de component
+     * arrays (getComponents()). Bedoeld voor headless runs en grote maps;
+     * getCoins()/getFruits()/getWalls() blijven werken als adapter (zie daar).
+     */
+    void setEntityStorage(EntityStorage storage) { entityStorage = storage; }
+    EntityStorage getEntityStorage() const { return entityStorage; }
+
+    /**
+     * @brief Component arrays van walls, coins en fruits (beide storage modes)
+     */
+    const ComponentStore& getComponents() const { return components; }
+
     // Entity accessors (voor AI en collision)
     PacMan* getPacMan() const { return pacman.get(); }
-    const std::vector<std::unique_ptr<Coin>>& getCoins() const { return coins; }
-    const std::vector<std::unique_ptr<Fruit>>& getFruits() const { return fruits; }
-    const std::vector<std::unique_ptr<Wall>>& getWalls() const { return walls; }
-    const std::vector<std::unique_ptr<Ghost>>& getGhosts() const { return ghosts; }
+
+    /**
+     * @brief Models van coins, fruits en walls
+     *
+     * In COMPONENTS mode een adapter: bij de eerste aanroep worden losse Models
+     * (zonder factory, Views of observers) uit de component arrays gemaakt,
+     * daarna enkel de collected flags bijgewerkt. Read-only snapshot:
+     * wijzigingen aan deze Models hebben geen effect op de World.
+     *
+     * NIET thread-safe ondanks const: de adapters zijn mutable caches. Enkel
+     * op de owner thread (zie setOwnerThread), dus niet vanaf de render thread
+     * terwijl een SimulationThread de World bezit. Render code leest de
+     * statische layout via getComponents() vóór SimulationThread::start().
+     * @throws std::logic_error in COMPONENTS mode vanaf een andere thread
+     */
+    const std::vector<EntityPtr<Coin>>& getCoins() const;
+    const std::vector<EntityPtr<Fruit>>& getFruits() const;
+    const std::vector<EntityPtr<Wall>>& getWalls() const;
+
+    /**
+     * @brief Thread die de World nu bezit (default: de constructor thread)
+     *
+     * SimulationThread claimt de World in run() en geeft hem na join() terug.
+     */
+    void setOwnerThread(std::thread::id id) { ownerThread.store(id, std::memory_order_release); }
+
+    /**
+     * @brief Wall tiles samengevoegd tot rechthoeken (collision; views gebruiken getWalls())
+     */
+    const std::vector<WallRect>& getWallRects() const { return wallRects; }
+    const std::vector<EntityPtr<Ghost>>& getGhosts() const { return ghosts; }
+
+    /**
+     * @brief Handle → Model lookup voor alle entities van de factory
+     */
+    const EntityRegistry& getEntityRegistry() const { return *entityRegistry; }
+
+    /**
+     * @brief SoA store achter alle Ghost facades (batched update)
+     */
+    GhostSystem& getGhostSystem() { return ghostSystem; }
+    const GhostSystem& getGhostSystem() const { return ghostSystem; }
 
     // Game state
     int getCurrentLevel() const { return currentLevel; }
@@ -112,6 +230,14 @@ public:
     Score& getScore() { return score; }
     const Score& getScore() const { return score; }
 
+    /**
+     * @brief Kopieer dynamische state (PacMan, ghosts, collected flags, score) naar out
+     *
+     * Hergebruikt de vectors van out (geen allocaties na de eerste keer).
+     * tick, elapsedTime en showingReady beheert de caller (SimulationThread).
+     */
+    void captureSnapshot(RenderSnapshot& out) const;
+
     MapDimensions getMapDimensions() const { return {mapRows, mapCols}; }
 
     /**
@@ -136,6 +262,23 @@ public:
      */
     bool wouldCollideWithWall(const Position& pos, float radius, const Ghost* ghost = nullptr) const;
 
+    /**
+     * @brief Swept AABB: hoe ver kan een box langs dir bewegen voor hij een wall raakt
+     * @param pos Startpositie (center)
+     * @param radius Collision radius
+     * @param dir Bewegingsrichting (NONE → 0)
+     * @param distance Gewenste afstand (speed * deltaTime)
+     * @param ghost Optional: door blokkeert ghosts die al door zijn geweest
+     * @return distance als het hele pad vrij is, anders de afstand tot het
+     *         eerste contact min een kleine skin (0 als de start al botst)
+     *
+     * Test het volledige pad, niet enkel de eindpositie: bij een grote
+     * deltaTime (lage tick rate, debugger pauze) kan niets door een wall
+     * van één tile springen.
+     */
+    float sweepWalls(const Position& pos, float radius, Direction dir, float distance,
+                     const Ghost* ghost = nullptr) const;
+
     // Door mechanisme
     Position getDoorPosition() const { return doorPosition; }
     bool isInsideSpawn(const Position& pos) const;
@@ -162,16 +305,86 @@ public:
 
     bool isPlayingDeathAnimation() const { return deathAnimationPlaying; }
 
+    /**
+     * @brief Kies physics mode (default CONTINUOUS)
+     *
+     * TILE_LATTICE: PacMan en ghosts bewegen op een integer tile rooster
+     * (zie TileLattice). Kan op elk moment: bij de volgende tick worden
+     * entities op het dichtstbijzijnde tile center gezet.
+     */
+    void setMovementMode(MovementMode mode) { movementMode = mode; }
+    MovementMode getMovementMode() const { return movementMode; }
+
+    /**
+     * @brief Walls/door als lookup tabel (gebouwd bij elk level)
+     */
+    const TileLattice& getTileLattice() const { return tileLattice; }
+
+    /**
+     * @brief Id van PacMan in queryDynamicEntities resultaten (ghosts: index in getGhosts())
+     */
+    static constexpr std::uint32_t PACMAN_ENTITY_ID = 0xFFFFFFFFu;
+
+    /**
+     * @brief Bewegende entities (PacMan, ghosts) waarvan de box area raakt
+     * @param area Zoekgebied (bv. box rond een ghost voor "wie is in de buurt")
+     * @param ids Output (wordt geleegd): ghost indices stijgend, PACMAN_ENTITY_ID laatst
+     *
+     * Vanaf getSpatialHashMinGhosts() ghosts via de spatial hash: kost ~
+     * entities in de tiles onder area, niet het totaal aantal ghosts. De hash
+     * volgt de posities na de movement fase van de laatste tick; de box test
+     * gebruikt de huidige posities. Minder ghosts: lineaire scan, geen hash.
+     */
+    void queryDynamicEntities(const BoundingBox& area, std::vector<std::uint32_t>& ids) const;
+
+    /**
+     * @brief Minimum aantal ghosts voor de spatial hash
+     *
+     * handleCollisions doet één query per tick: hash herbouwen + query kost
+     * 5-7x een lineaire box test per ghost (gemeten van 4 tot 248 ghosts op
+     * een 255x255 map). De hash loont pas met veel queries per tick.
+     * Geen meegeleverde map en geen gegenereerde map met default config komt
+     * aan 512 ghosts: standaard gebruikt de World de hash dus nooit.
+     * (MapGenerator::maxGhosts laat tot 994 toe op een 1000x1000 map.)
+     * 0 = altijd de hash (bv. om de hash zelf te benchmarken).
+     */
+    static constexpr std::size_t DEFAULT_SPATIAL_HASH_MIN_GHOSTS = 512;
+    void setSpatialHashMinGhosts(std::size_t count);
+    std::size_t getSpatialHashMinGhosts() const { return spatialHashMinGhosts; }
+    bool usesSpatialHash() const { return ghosts.size() >= spatialHashMinGhosts; }
+
 private:
     AbstractFactory& factory;  // Reference - factory moet bestaan tijdens World lifetime
     std::shared_ptr<Camera> camera;
 
-    // Entity containers (ownership via unique_ptr)
-    std::unique_ptr<PacMan> pacman;
-    std::vector<std::unique_ptr<Coin>> coins;
-    std::vector<std::unique_ptr<Fruit>> fruits;
-    std::vector<std::unique_ptr<Wall>> walls;
-    std::vector<std::unique_ptr<Ghost>> ghosts;
+    // Handles van alle Models (gedeeld met factory en Views) - gedeclareerd voor
+    // de entities: ~EntityModel meldt zich hier af
+    std::shared_ptr<EntityRegistry> entityRegistry;
+
+    // Ghost state (SoA) - gedeclareerd voor ghosts: Ghost destructors melden zich hier af
+    GhostSystem ghostSystem;
+
+    // Entity containers (ownership via EntityPtr, geheugen eventueel in de LevelArena van de factory)
+    EntityPtr<PacMan> pacman;
+    std::vector<EntityPtr<Coin>> coins;
+    std::vector<EntityPtr<Fruit>> fruits;
+    std::vector<EntityPtr<Wall>> walls;
+    std::vector<EntityPtr<Ghost>> ghosts;
+
+    // Statische entities als component arrays (bron van waarheid voor collision en pickup)
+    EntityStorage entityStorage = EntityStorage::OBJECTS;
+    ComponentStore components;
+
+    // getCoins()/getFruits()/getWalls() adapters in COMPONENTS mode (lazy, enkel owner thread)
+    mutable std::vector<EntityPtr<Coin>> coinAdapters;
+    mutable std::vector<EntityPtr<Fruit>> fruitAdapters;
+    mutable std::vector<EntityPtr<Wall>> wallAdapters;
+    std::atomic<std::thread::id> ownerThread{std::this_thread::get_id()};
+
+    /**
+     * @brief Gooi std::logic_error als de caller niet de owner thread is (adapters)
+     */
+    void requireOwnerThread(const char* caller) const;
 
     int currentLevel = 1;
     Score score;
@@ -198,12 +411,97 @@ private:
     float spawnTop = -0.1f;
     float spawnBottom = 0.1f;
 
+    // Tile lattice movement (MovementMode::TILE_LATTICE)
+    MovementMode movementMode = MovementMode::CONTINUOUS;
+    TileLattice tileLattice;
+    LatticePosition pacmanLattice;
+    std::int64_t pacmanLatticeCarry = 0;
+
+    /**
+     * @brief PacMan movement op het tile rooster
+     *
+     * 180° turns meteen, andere buffered turns (PacMan::getNextDirection)
+     * op het eerstvolgende tile center waar de buur tile open is.
+     */
+    void updatePacManOnLattice(float deltaTime);
+
     // Difficulty parameters
     float fearModeDuration = 5.0f;
 
+    GhostRoster ghostRoster;
+
+    /**
+     * @brief Wall collision geometrie
+     *
+     * Bij het laden worden aaneengesloten wall tiles samengevoegd tot maximale
+     * rechthoeken (wallRects); wallTiles geeft per tile de index van zijn
+     * rechthoek, of -1. Een wall query bekijkt enkel de tiles onder de test box
+     * en test elke rechthoek één keer: een gang van 20 tiles is één kandidaat
+     * ipv 20. De Wall entities zelf blijven per tile bestaan (views).
+     *
+     * Tussen naburige tile boxes zit een spleet van 0.02 tile (radius 0.49);
+     * een rechthoek dicht die. Boxes breder dan de spleet (alle entities) raken
+     * de rechthoek exact wanneer ze een van zijn tiles raken.
+     */
+    std::vector<WallRect> wallRects;
+    std::vector<int> wallTiles;
+
+    struct TileRange {
+        int firstRow;
+        int lastRow;
+        int firstCol;
+        int lastCol;
+    };
+
+    /**
+     * @brief Tiles onder box (1 tile marge tegen afrondingsfouten), geclampt op de map
+     */
+    TileRange tilesUnder(const BoundingBox& box) const;
+
+    /**
+     * @brief Check box tegen wall rechthoeken via wallTiles
+     * @return true als box een wall rechthoek raakt
+     */
+    bool intersectsWall(const BoundingBox& box) const;
+
+    /**
+     * @brief Bouw wallTiles en wallRects (na setCollisionRadius van de walls)
+     */
+    void buildWallTiles();
+
+    // Broad-phase voor handleCollisions (index = index in coins/fruits)
+    AabbBatch coinBoxes;
+    AabbBatch fruitBoxes;
+    std::vector<std::uint32_t> collisionHits;  // Scratch, hergebruikt per query
+
+    void buildCollectibleBoxes();
+
+    /**
+     * @brief Scoring voor een collectible zonder Model (COMPONENTS mode)
+     */
+    void notifyCollected(EventType type, const Collectible& collectible);
+
+    // Bewegende entities per tile (ghost index / PACMAN_ENTITY_ID)
+    SpatialHash dynamicEntities;
+    std::size_t spatialHashMinGhosts = DEFAULT_SPATIAL_HASH_MIN_GHOSTS;
+    float maxDynamicRadius = 0.0f;  // Grootste collision radius in de hash (query marge)
+    mutable std::vector<std::uint32_t> dynamicCandidates;  // Scratch voor queryDynamicEntities
+
+    /**
+     * @brief Herbouw de spatial hash uit de huidige posities (elke tick na movement)
+     *
+     * No-op onder getSpatialHashMinGhosts() ghosts (queries zijn dan lineair).
+     */
+    void rebuildDynamicEntities();
+
     /**
      * @brief Detecteer en verwerk collisions tussen entities
      *
+     * PacMan's box wordt getest tegen AabbBatch broad-phases (SIMD) voor
+     * coins/fruits (statisch, opgepakt = disabled) en tegen de spatial hash
+     * voor ghosts (enkel ghosts in de tiles rond PacMan). Hits komen in index
+     * volgorde, dus verwerking is identiek aan de vroegere lineaire loops.
+     *
      * Collision types:
      * - PacMan <-> Coin: collect coin, add points
      * - PacMan <-> Fruit: collect fruit, activate fear mode
@@ -13,6 +13,7 @@ namespace pacman {
 class Coin : public EntityModel {
 public:
     explicit Coin(const Position& pos);
+    Coin(Coin&&) noexcept = default;  // Pool relocatie: handle volgt mee
     ~Coin() override = default;
 
     void update(float deltaTime) override;
@@ -21,10 +22,12 @@ public:
     void collect();
 
     int getPointValue() const { return pointValue; }
-    
+
+    static constexpr int POINT_VALUE = 10;
+
 private:
     bool collected = false;
-    int pointValue = 10;
+    int pointValue = POINT_VALUE;
 };
 
 } // namespace pacman
\ No newline at end of file
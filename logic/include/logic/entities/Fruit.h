@@ -13,6 +13,7 @@ namespace pacman {
 class Fruit : public EntityModel {
 public:
     explicit Fruit(const Position& pos);
+    Fruit(Fruit&&) noexcept = default;  // Pool relocatie: handle volgt mee
     ~Fruit() override = default;
 
     void update(float deltaTime) override;
@@ -21,10 +22,12 @@ public:
     void collect();
 
     int getPointValue() const { return pointValue; }
-    
+
+    static constexpr int POINT_VALUE = 50;
+
 private:
     bool collected = false;
-    int pointValue = 50;
+    int pointValue = POINT_VALUE;
 };
 
 } // namespace pacman
\ No newline at end of file
@@ -1,6 +1,7 @@
 #pragma once
 #include "logic/EntityModel.h"
 #include "logic/World.h"
+#include "logic/GhostSystem.h"
 
 namespace pacman {
 
@@ -25,7 +26,7 @@ enum class GhostState {
 };
 
 /**
- * @brief Abstracte basisklasse voor ghost AI
+ * @brief Abstracte basisklasse voor ghost AI (facade over GhostSystem)
  *
  * Ghosts hebben verschillende AI strategieën (geïmplementeerd in subklassen):
  * - RedGhost: Direct chaser (minimaliseer Manhattan distance)
@@ -42,33 +43,61 @@ enum class GhostState {
  * - Alleen direction changes bij intersections (3+ viable directions)
  * - Geen 180° turns (kan niet omdraaien)
  * - Door blokkering: ghosts kunnen 1x door, daarna geblokkeerd
+ *
+ * === STORAGE ===
+ * De state (positie, direction, speed, timers, states) leeft in de
+ * GhostSystem van de World (SoA, batched update). Ghost registreert zich
+ * bij constructie en is daarna een dunne facade voor views en AI:
+ * - Getters lezen uit de GhostSystem arrays
+ * - EntityModel::position/speed worden gesynct voor getPosition()/views
+ * - setPosition/setSpeed/setCollisionRadius overriden de EntityModel
+ *   setters en schrijven door naar de GhostSystem (ook via EntityModel*)
  */
 class Ghost : public EntityModel {
 public:
     /**
-     * @brief Constructor
+     * @brief Constructor - registreert ghost in world.getGhostSystem()
      * @param world Reference naar World (voor pathfinding en PacMan positie)
      * @param pos Spawn positie (center van map)
      * @param color Ghost kleur (voor visuals)
      * @param spawnDelay Tijd in seconden voordat ghost spawn verlaat
      */
     explicit Ghost(World& world, const Position& pos, GhostColor color, float spawnDelay);
-    virtual ~Ghost() = default;
+    ~Ghost() override;
+
+    Ghost(const Ghost&) = delete;
+    Ghost& operator=(const Ghost&) = delete;
 
+    /**
+     * @brief Update enkel deze ghost (World gebruikt GhostSystem::update voor alle ghosts)
+     */
     void update(float deltaTime) override;
 
     // State getters
     GhostColor getColor() const { return color; }
-    GhostState getState() const { return state; }
-    Direction getCurrentDirection() const { return currentDirection; }
-    float getScaredTimeRemaining() const { return scaredTimer; }
+    GhostState getState() const;
+    Direction getCurrentDirection() const;
+    float getScaredTimeRemaining() const;
 
     // Difficulty scaling
-    void setNormalSpeed(float speed) { normalSpeed = speed; }
+    void setNormalSpeed(float speed);
+
+    /**
+     * @brief Overschrijf spawn delay van de personality (bv. via GhostRoster)
+     *
+     * Geldt voor de huidige spawn en elke reset().
+     */
+    void setSpawnDelay(float delay);
+    float getSpawnDelay() const;
 
     // Door passage tracking (ghosts kunnen 1x door, daarna geblokkeerd)
-    bool hasPassedThroughDoor() const { return hasPassedDoor; }
-    void markPassedDoor() { hasPassedDoor = true; }
+    bool hasPassedThroughDoor() const;
+    void markPassedDoor();
+
+    // Schrijven door naar GhostSystem
+    void setPosition(const Position& pos) override;
+    void setSpeed(float spd) override;
+    void setCollisionRadius(float radius) override;
 
     /**
      * @brief Activeer scared mode
@@ -80,7 +109,7 @@ public:
      */
     void enterScaredMode(float duration);
 
-    bool isScared() const { return state == GhostState::SCARED; }
+    bool isScared() const { return getState() == GhostState::SCARED; }
 
     /**
      * @brief Respawn na opgegeten te zijn
@@ -99,12 +128,14 @@ public:
 
     void die();
 
+    std::size_t getSlot() const { return slot; }
+
 protected:
     /**
      * @brief Pure virtual: AI strategy voor direction keuze
      * @return Nieuwe direction op basis van AI logica
      *
-     * Wordt ALLEEN aangeroepen bij intersections.
+     * Wordt ALLEEN aangeroepen bij intersections (door GhostSystem).
      * Moet rekening houden met:
      * - Geen 180° turns
      * - Viable directions (geen muren)
@@ -133,27 +164,13 @@ protected:
     Direction getBestDirectionToTarget(const Position& target, bool maximize = false) const;
 
     World& world;  // Reference niet pointer - ghost MOET valid world hebben
-    Direction currentDirection = Direction::RIGHT;
 
 private:
+    friend class GhostSystem;
+
+    GhostSystem& system;
+    std::size_t slot;  // Index in GhostSystem arrays (aangepast door GhostSystem::remove)
     GhostColor color;
-    GhostState state = GhostState::IN_SPAWN;
-    Position spawnPosition;
-
-    float spawnTimer = 0.0f;
-    bool hasPassedDoor = false;
-
-    float scaredTimer = 0.0f;
-    float normalSpeed = 0.15f;
-    GhostState previousState = GhostState::ON_MAP;
-    float initialSpawnDelay = 0.0f;
-
-    void move(float deltaTime);
-    void handleWallCollision();
-    bool isOpposite(Direction dir1, Direction dir2) const;
-    float calculateManhattanDistance(const Position& from, const Position& to) const;
-    Direction chooseDirectionAtIntersection();
-    Direction getOppositeDirection(Direction dir) const;
 };
 
-} // namespace pacman
\ No newline at end of file
+} // namespace pacman
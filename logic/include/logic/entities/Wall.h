@@ -12,6 +12,7 @@ namespace pacman {
 class Wall : public EntityModel {
 public:
     explicit Wall(const Position& pos);
+    Wall(Wall&&) noexcept = default;  // Pool relocatie: handle volgt mee
     ~Wall() override = default;
 
     void update(float deltaTime) override;
@@ -15,6 +15,9 @@ namespace pacman {
  * 1. Observer attach bij creation (in ConcreteFactory)
  * 2. Subject::notify() bij relevante state changes
  * 3. Observer detach bij destruction (automatic in ~EntityView)
+ *
+ * Omgekeerde richting (Observer → Subject) loopt via een EntityHandle
+ * (EntityRegistry): een View detacht enkel als zijn Model nog bestaat.
  */
 class Subject {
 public:
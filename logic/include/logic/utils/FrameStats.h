@@ -0,0 +1,168 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace pacman {
+
+/**
+ * @brief HDR-style histogram - percentielen met begrensde relatieve fout
+ *
+ * === BUCKET LAYOUT (log-linear) ===
+ * - Waarden < 2^subBucketBits: exacte buckets (1 per waarde)
+ * - Daarboven: per macht van 2 telkens 2^(subBucketBits-1) lineaire buckets
+ *
+ * Relatieve fout per waarde <= 1 / 2^(subBucketBits-1).
+ * Met subBucketBits = 7: < 1.6% fout, ~2000 buckets voor bereik tot 2^36.
+ *
+ * Record is O(1) (bit_width + shift), percentiel query is O(buckets).
+ * Waarden zijn unitless; FrameStats gebruikt microseconden.
+ */
+class HdrHistogram {
+public:
+    explicit HdrHistogram(int subBucketBits = 7, int maxValueBits = 36);
+
+    /**
+     * @brief Registreer één waarde (clamped naar max bereik)
+     */
+    void record(std::uint64_t value);
+
+    /**
+     * @brief Waarde op percentiel
+     * @param percentile In [0, 100]
+     * @return Hoogste equivalente waarde van bucket (nooit > getMax())
+     */
+    std::uint64_t valueAtPercentile(double percentile) const;
+
+    std::uint64_t getCount() const { return totalCount; }
+    std::uint64_t getMin() const { return totalCount ? minValue : 0; }
+    std::uint64_t getMax() const { return maxValue; }
+    double getMean() const;
+
+    void reset();
+
+private:
+    int subBucketBits;
+    std::uint64_t subBucketCount;      // 2^subBucketBits
+    std::uint64_t subBucketHalfCount;  // 2^(subBucketBits-1)
+    std::uint64_t maxTrackableValue;
+
+    std::vector<std::uint64_t> counts;
+    std::uint64_t totalCount = 0;
+    std::uint64_t minValue = 0;
+    std::uint64_t maxValue = 0;
+    long double sum = 0.0L;
+
+    std::size_t bucketIndex(std::uint64_t value) const;
+    std::uint64_t highestEquivalentValue(std::size_t index) const;
+};
+
+/**
+ * @brief Tijden van één frame (microseconden)
+ *
+ * - update: StateManager::update (game logic)
+ * - render: clear + StateManager::render (draw calls)
+ * - present: window.display() (incl. framerate limiter sleep en vsync)
+ * - frame: volledige loop iteratie
+ */
+struct FrameSample {
+    std::uint64_t updateUs = 0;
+    std::uint64_t renderUs = 0;
+    std::uint64_t presentUs = 0;
+    std::uint64_t frameUs = 0;
+};
+
+/**
+ * @brief Singleton FrameStats - frame pacing statistieken
+ *
+ * === DOEL ===
+ * Game::run() capt op 60 FPS maar mat niets. FrameStats houdt per fase
+ * een HdrHistogram bij (p50/p95/p99/max) plus hitch tellers:
+ * - Hitch: frame > 2x target frametijd
+ * - Severe hitch: frame > 4x target frametijd
+ *
+ * === USAGE ===
+ * ```cpp
+ * // In Game::run() na elke frame:
+ * FrameStats::getInstance().record(sample);
+ *
+ * // Bij afsluiten:
+ * FrameStats::getInstance().writeSummary("frame_stats.txt");
+ * ```
+ *
+ * LevelState toont een overlay (F3) met getOverlayText().
+ */
+class FrameStats {
+public:
+    /**
+     * @brief Verkrijg singleton instance
+     * @return Reference naar enige FrameStats instance
+     */
+    static FrameStats& getInstance() {
+        static FrameStats instance;
+        return instance;
+    }
+
+    // Delete copy/move (singleton)
+    FrameStats(const FrameStats&) = delete;
+    FrameStats& operator=(const FrameStats&) = delete;
+    FrameStats(FrameStats&&) = delete;
+    FrameStats& operator=(FrameStats&&) = delete;
+
+    /**
+     * @brief Stel target frametijd in (bepaalt hitch drempels)
+     * @param seconds Bv. 1.0f / 60 voor 60 FPS cap
+     */
+    void setTargetFrameTime(float seconds);
+    float getTargetFrameTime() const { return targetFrameTime; }
+
+    /**
+     * @brief Registreer één frame
+     */
+    void record(const FrameSample& sample);
+
+    void reset();
+
+    const HdrHistogram& getUpdateHistogram() const { return updateHistogram; }
+    const HdrHistogram& getRenderHistogram() const { return renderHistogram; }
+    const HdrHistogram& getPresentHistogram() const { return presentHistogram; }
+    const HdrHistogram& getFrameHistogram() const { return frameHistogram; }
+
+    std::uint64_t getFrameCount() const { return frameHistogram.getCount(); }
+    std::uint64_t getHitchCount() const { return hitchCount; }
+    std::uint64_t getSevereHitchCount() const { return severeHitchCount; }
+    const FrameSample& getLastSample() const { return lastSample; }
+
+    /**
+     * @brief Compacte multi-line tekst voor on-screen overlay
+     *
+     * Formaat (ms): "FRAME p50 p95 p99 max" per fase + hitch tellers.
+     */
+    std::string getOverlayText() const;
+
+    /**
+     * @brief Schrijf samenvatting naar text file
+     * @param filename Output pad
+     * @return true bij succes
+     *
+     * Bevat machine/build info zodat builds tussen machines vergeleken kunnen worden.
+     */
+    bool writeSummary(const std::string& filename) const;
+
+private:
+    FrameStats() = default;
+
+    float targetFrameTime = 1.0f / 60.0f;
+
+    HdrHistogram updateHistogram;
+    HdrHistogram renderHistogram;
+    HdrHistogram presentHistogram;
+    HdrHistogram frameHistogram;
+
+    std::uint64_t hitchCount = 0;
+    std::uint64_t severeHitchCount = 0;
+    FrameSample lastSample;
+};
+
+} // namespace pacman
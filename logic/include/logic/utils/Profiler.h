@@ -0,0 +1,162 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace pacman {
+
+/**
+ * @brief Eén gemeten zone (naam + start + duur)
+ *
+ * name moet een string literal zijn (pointer wordt bewaard, niet gekopieerd).
+ */
+struct ProfileZone {
+    const char* name = nullptr;
+    std::int64_t startNs = 0;     // Nanoseconden sinds profiler epoch
+    std::int64_t durationNs = 0;
+};
+
+/**
+ * @brief Singleton Profiler - per-frame instrumentatie met Chrome trace export
+ *
+ * === DOEL ===
+ * Stopwatch meet enkel de totale frametijd. De Profiler meet WAAR die tijd
+ * naartoe gaat via RAII zones rond de hot paths:
+ * - Game::processEvents
+ * - World::update / World::handleCollisions
+ * - GhostSystem::update (alle ghosts, batched)
+ * - LevelState::render
+ *
+ * === PER-THREAD BUFFERS ===
+ * Elke thread schrijft in zijn eigen ring buffer (single writer):
+ * - Geen locks of CAS op het record pad, enkel een release store van de index
+ * - Registratie van een nieuwe thread neemt 1x een mutex (eerste zone)
+ * - Buffer vol: oudste zones worden overschreven
+ *
+ * === EXPORT ===
+ * writeChromeTrace() schrijft JSON in het Trace Event formaat
+ * (chrome://tracing of https://ui.perfetto.dev).
+ * Roep aan wanneer geen zones meer actief zijn (bv. bij afsluiten).
+ *
+ * === COMPILE-OUT ===
+ * PACMAN_PROFILE_SCOPE is een no-op tenzij PACMAN_PROFILING gedefinieerd is
+ * (CMake optie PACMAN_ENABLE_PROFILING, default OFF).
+ */
+class Profiler {
+public:
+    /**
+     * @brief Verkrijg singleton instance
+     * @return Reference naar enige Profiler instance
+     */
+    static Profiler& getInstance() {
+        static Profiler instance;
+        return instance;
+    }
+
+    // Delete copy/move (singleton)
+    Profiler(const Profiler&) = delete;
+    Profiler& operator=(const Profiler&) = delete;
+    Profiler(Profiler&&) = delete;
+    Profiler& operator=(Profiler&&) = delete;
+
+    /**
+     * @brief Huidige tijd in nanoseconden sinds profiler epoch
+     */
+    std::int64_t now() const {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - epoch).count();
+    }
+
+    /**
+     * @brief Registreer afgesloten zone in buffer van calling thread
+     * @param name String literal (bv. "World::update")
+     * @param startNs Start tijd (van now())
+     * @param endNs Eind tijd (van now())
+     */
+    void record(const char* name, std::int64_t startNs, std::int64_t endNs);
+
+    /**
+     * @brief Schrijf alle gebufferde zones als Chrome trace JSON
+     * @param filename Output pad (bv. "profile_trace.json")
+     * @return true bij succes
+     */
+    bool writeChromeTrace(const std::string& filename) const;
+
+    /**
+     * @brief Verwijder alle gebufferde zones (buffers blijven gealloceerd)
+     *
+     * Enkel aanroepen wanneer geen andere thread zones aan het schrijven is.
+     */
+    void clear();
+
+    /**
+     * @brief Totaal aantal geregistreerde zones (incl. overschreven)
+     */
+    std::size_t getRecordedCount() const;
+
+    static constexpr std::size_t BUFFER_CAPACITY = 1 << 16;  // Zones per thread
+
+private:
+    struct ThreadBuffer {
+        std::uint32_t threadId = 0;
+        std::unique_ptr<ProfileZone[]> zones;
+        std::atomic<std::size_t> writeIndex{0};  // Monotoon stijgend, slot = index % capacity
+    };
+
+    Profiler() : epoch(std::chrono::steady_clock::now()) {}
+
+    /**
+     * @brief Buffer van calling thread (lazy aangemaakt bij eerste zone)
+     */
+    ThreadBuffer& localBuffer();
+
+    std::chrono::steady_clock::time_point epoch;
+
+    mutable std::mutex registryMutex;                   // Beschermt enkel buffers vector
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;  // Owned, leven tot einde programma
+};
+
+/**
+ * @brief RAII zone - meet tijd tussen constructie en destructie
+ *
+ * Gebruik via macro zodat release builds niets betalen:
+ * ```cpp
+ * void World::update(float deltaTime) {
+ *     PACMAN_PROFILE_SCOPE("World::update");
+ *     ...
+ * }
+ * ```
+ */
+class ScopedZone {
+public:
+    explicit ScopedZone(const char* name)
+        : name(name), startNs(Profiler::getInstance().now()) {}
+
+    ~ScopedZone() {
+        auto& profiler = Profiler::getInstance();
+        profiler.record(name, startNs, profiler.now());
+    }
+
+    ScopedZone(const ScopedZone&) = delete;
+    ScopedZone& operator=(const ScopedZone&) = delete;
+
+private:
+    const char* name;
+    std::int64_t startNs;
+};
+
+} // namespace pacman
+
+#define PACMAN_PROFILE_CONCAT_INNER(a, b) a##b
+#define PACMAN_PROFILE_CONCAT(a, b) PACMAN_PROFILE_CONCAT_INNER(a, b)
+
+#ifdef PACMAN_PROFILING
+#define PACMAN_PROFILE_SCOPE(name) ::pacman::ScopedZone PACMAN_PROFILE_CONCAT(pacmanProfileZone, __LINE__)(name)
+#else
+#define PACMAN_PROFILE_SCOPE(name) ((void)0)
+#endif
@@ -74,6 +74,16 @@ public:
         return dist(generator);
     }
 
+    /**
+     * @brief Herseed generator met vaste waarde
+     * @param value Seed
+     *
+     * Gebruikt voor deterministische runs (benchmarks, headless simulaties).
+     */
+    void seed(unsigned int value) {
+        generator.seed(value);
+    }
+
 private:
     /**
      * @brief Private constructor (singleton)
@@ -0,0 +1,57 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace pacman {
+
+/**
+ * @brief Lock-free bounded queue: één producer thread, één consumer thread
+ *
+ * Ring buffer met Capacity slots (macht van 2). head wordt enkel door de
+ * consumer geschreven, tail enkel door de producer; elk leest de andere met
+ * acquire. Vol → push() faalt (caller beslist: droppen of later opnieuw).
+ *
+ * head en tail staan op aparte cache lines (geen false sharing).
+ */
+template <typename T, std::size_t Capacity>
+class SpscQueue {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity moet een macht van 2 zijn");
+
+public:
+    /**
+     * @brief Voeg item toe (producer thread)
+     * @return false als de queue vol is
+     */
+    bool push(const T& item) {
+        std::size_t t = tail.load(std::memory_order_relaxed);
+        if (t - head.load(std::memory_order_acquire) == Capacity) return false;
+
+        slots[t & MASK] = item;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Haal oudste item op (consumer thread)
+     * @return false als de queue leeg is
+     */
+    bool pop(T& item) {
+        std::size_t h = head.load(std::memory_order_relaxed);
+        if (h == tail.load(std::memory_order_acquire)) return false;
+
+        item = slots[h & MASK];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    static constexpr std::size_t MASK = Capacity - 1;
+    static constexpr std::size_t CACHE_LINE = 64;
+
+    std::array<T, Capacity> slots{};
+    alignas(CACHE_LINE) std::atomic<std::size_t> head{0};  // Consumer
+    alignas(CACHE_LINE) std::atomic<std::size_t> tail{0};  // Producer
+};
+
+} // namespace pacman
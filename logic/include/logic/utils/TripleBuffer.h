@@ -0,0 +1,68 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+namespace pacman {
+
+/**
+ * @brief Lock-free triple buffer: één writer thread, één reader thread
+ *
+ * === WERKING ===
+ * Drie buffers met vaste rollen die enkel via één atomic (middle) wisselen:
+ * - write: enkel van de writer, wordt in place gevuld
+ * - middle: laatst gepubliceerde buffer (+ FRESH bit)
+ * - read: enkel van de reader, blijft geldig tot de volgende acquire()
+ *
+ * publish() ruilt write ↔ middle, acquire() ruilt read ↔ middle als er iets
+ * nieuws is. Geen van beide wacht ooit op de andere: een trage reader laat
+ * tussenliggende publicaties vallen (hij ziet altijd de laatste), een trage
+ * writer laat de reader gewoon de vorige buffer hertekenen.
+ *
+ * Buffers worden hergebruikt: T met vectors alloceert na de eerste rondes niet meer.
+ */
+template <typename T>
+class TripleBuffer {
+public:
+    /**
+     * @brief Buffer die de writer mag vullen (niet zichtbaar voor de reader)
+     */
+    T& writeBuffer() { return buffers[writeIndex]; }
+
+    /**
+     * @brief Maak writeBuffer() zichtbaar voor de reader (writer thread)
+     */
+    void publish() {
+        std::uint8_t previous = middle.exchange(static_cast<std::uint8_t>(writeIndex | FRESH_BIT),
+                                                std::memory_order_acq_rel);
+        writeIndex = previous & INDEX_MASK;
+    }
+
+    /**
+     * @brief Neem de laatst gepubliceerde buffer over (reader thread)
+     * @return true als readBuffer() nu een nieuwere buffer is
+     */
+    bool acquire() {
+        if ((middle.load(std::memory_order_acquire) & FRESH_BIT) == 0) return false;
+
+        std::uint8_t previous = middle.exchange(readIndex, std::memory_order_acq_rel);
+        readIndex = previous & INDEX_MASK;
+        return true;
+    }
+
+    /**
+     * @brief Huidige buffer van de reader (onveranderd tot de volgende acquire())
+     */
+    const T& readBuffer() const { return buffers[readIndex]; }
+
+private:
+    static constexpr std::uint8_t INDEX_MASK = 0x3;
+    static constexpr std::uint8_t FRESH_BIT = 0x4;
+
+    std::array<T, 3> buffers{};
+    std::atomic<std::uint8_t> middle{1};
+    std::uint8_t writeIndex = 0;  // Enkel writer
+    std::uint8_t readIndex = 2;   // Enkel reader
+};
+
+} // namespace pacman
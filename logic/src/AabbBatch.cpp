@@ -0,0 +1,183 @@
+#include "logic/AabbBatch.h"
+#include <limits>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define PACMAN_AABB_X86 1
+#include <immintrin.h>
+#endif
+
+namespace pacman {
+
+namespace {
+
+constexpr float INF = std::numeric_limits<float>::infinity();
+
+// Dode box: left > alles en right < alles → matcht nooit
+constexpr float DEAD_LEFT = INF;
+constexpr float DEAD_TOP = INF;
+constexpr float DEAD_RIGHT = -INF;
+constexpr float DEAD_BOTTOM = -INF;
+
+struct QueryArgs {
+    const float* lefts;
+    const float* tops;
+    const float* rights;
+    const float* bottoms;
+    std::size_t paddedCount;  // Veelvoud van AabbBatch::LANES
+};
+
+void queryScalar(const QueryArgs& args, const BoundingBox& box, std::vector<std::uint32_t>& hits) {
+    const float boxRight = box.right();
+    const float boxBottom = box.bottom();
+
+    for (std::size_t i = 0; i < args.paddedCount; ++i) {
+        // Letterlijk BoundingBox::intersects met box als "this"
+        bool hit = !(boxRight < args.lefts[i] ||
+                     box.left > args.rights[i] ||
+                     boxBottom < args.tops[i] ||
+                     box.top > args.bottoms[i]);
+        if (hit) {
+            hits.push_back(static_cast<std::uint32_t>(i));
+        }
+    }
+}
+
+#ifdef PACMAN_AABB_X86
+
+void appendMask(unsigned mask, std::size_t base, std::vector<std::uint32_t>& hits) {
+    while (mask) {
+        hits.push_back(static_cast<std::uint32_t>(base + __builtin_ctz(mask)));
+        mask &= mask - 1;
+    }
+}
+
+__attribute__((target("sse2")))
+void querySse2(const QueryArgs& args, const BoundingBox& box, std::vector<std::uint32_t>& hits) {
+    const __m128 boxLeft = _mm_set1_ps(box.left);
+    const __m128 boxTop = _mm_set1_ps(box.top);
+    const __m128 boxRight = _mm_set1_ps(box.right());
+    const __m128 boxBottom = _mm_set1_ps(box.bottom());
+
+    for (std::size_t i = 0; i < args.paddedCount; i += 4) {
+        // !(boxRight < left) == !(left > boxRight), enz. ("not" vergelijkingen: NaN gedrag identiek)
+        __m128 x = _mm_and_ps(_mm_cmpngt_ps(_mm_loadu_ps(args.lefts + i), boxRight),
+                              _mm_cmpnlt_ps(_mm_loadu_ps(args.rights + i), boxLeft));
+        __m128 y = _mm_and_ps(_mm_cmpngt_ps(_mm_loadu_ps(args.tops + i), boxBottom),
+                              _mm_cmpnlt_ps(_mm_loadu_ps(args.bottoms + i), boxTop));
+
+        appendMask(static_cast<unsigned>(_mm_movemask_ps(_mm_and_ps(x, y))), i, hits);
+    }
+}
+
+__attribute__((target("avx2")))
+void queryAvx2(const QueryArgs& args, const BoundingBox& box, std::vector<std::uint32_t>& hits) {
+    const __m256 boxLeft = _mm256_set1_ps(box.left);
+    const __m256 boxTop = _mm256_set1_ps(box.top);
+    const __m256 boxRight = _mm256_set1_ps(box.right());
+    const __m256 boxBottom = _mm256_set1_ps(box.bottom());
+
+    for (std::size_t i = 0; i < args.paddedCount; i += 8) {
+        __m256 x = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(args.lefts + i), boxRight, _CMP_NGT_UQ),
+                                 _mm256_cmp_ps(_mm256_loadu_ps(args.rights + i), boxLeft, _CMP_NLT_UQ));
+        __m256 y = _mm256_and_ps(_mm256_cmp_ps(_mm256_loadu_ps(args.tops + i), boxBottom, _CMP_NGT_UQ),
+                                 _mm256_cmp_ps(_mm256_loadu_ps(args.bottoms + i), boxTop, _CMP_NLT_UQ));
+
+        appendMask(static_cast<unsigned>(_mm256_movemask_ps(_mm256_and_ps(x, y))), i, hits);
+    }
+}
+
+#endif
+
+} // namespace
+
+AabbBatch::AabbBatch() : kernel(detectKernel()) {}
+
+AabbKernel AabbBatch::detectKernel() {
+#ifdef PACMAN_AABB_X86
+    static const AabbKernel detected = []() {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return AabbKernel::AVX2;
+        if (__builtin_cpu_supports("sse2")) return AabbKernel::SSE2;
+        return AabbKernel::SCALAR;
+    }();
+    return detected;
+#else
+    return AabbKernel::SCALAR;
+#endif
+}
+
+const char* AabbBatch::kernelName(AabbKernel kernel) {
+    switch (kernel) {
+    case AabbKernel::AVX2: return "avx2";
+    case AabbKernel::SSE2: return "sse2";
+    default:               return "scalar";
+    }
+}
+
+void AabbBatch::setKernel(AabbKernel requested) {
+    // Nooit een kernel die de CPU niet ondersteunt
+    kernel = static_cast<int>(requested) <= static_cast<int>(detectKernel()) ? requested : detectKernel();
+}
+
+void AabbBatch::clear() {
+    count = 0;
+    lefts.clear();
+    tops.clear();
+    rights.clear();
+    bottoms.clear();
+}
+
+void AabbBatch::reserve(std::size_t capacity) {
+    std::size_t padded = (capacity + LANES - 1) / LANES * LANES;
+    lefts.reserve(padded);
+    tops.reserve(padded);
+    rights.reserve(padded);
+    bottoms.reserve(padded);
+}
+
+std::size_t AabbBatch::add(const BoundingBox& box) {
+    if (count == lefts.size()) {
+        // Nieuw blok van LANES dode boxes
+        lefts.resize(count + LANES, DEAD_LEFT);
+        tops.resize(count + LANES, DEAD_TOP);
+        rights.resize(count + LANES, DEAD_RIGHT);
+        bottoms.resize(count + LANES, DEAD_BOTTOM);
+    }
+
+    set(count, box);
+    return count++;
+}
+
+void AabbBatch::set(std::size_t index, const BoundingBox& box) {
+    lefts[index] = box.left;
+    tops[index] = box.top;
+    rights[index] = box.right();
+    bottoms[index] = box.bottom();
+}
+
+void AabbBatch::disable(std::size_t index) {
+    lefts[index] = DEAD_LEFT;
+    tops[index] = DEAD_TOP;
+    rights[index] = DEAD_RIGHT;
+    bottoms[index] = DEAD_BOTTOM;
+}
+
+void AabbBatch::query(const BoundingBox& box, std::vector<std::uint32_t>& hits) const {
+    QueryArgs args{lefts.data(), tops.data(), rights.data(), bottoms.data(), lefts.size()};
+
+    switch (kernel) {
+#ifdef PACMAN_AABB_X86
+    case AabbKernel::AVX2:
+        queryAvx2(args, box, hits);
+        break;
+    case AabbKernel::SSE2:
+        querySse2(args, box, hits);
+        break;
+#endif
+    default:
+        queryScalar(args, box, hits);
+        break;
+    }
+}
+
+} // namespace pacman
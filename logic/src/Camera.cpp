@@ -1,5 +1,6 @@
 #include "logic/Camera.h"
 #include <algorithm>
+#include <cmath>
 #include <iostream>
 
 namespace pacman {
@@ -21,9 +22,17 @@ void Camera::setMapDimensions(int rows, int cols) {
 }
 
 void Camera::calculateScale() {
+    // Zichtbaar stuk: hele map (FIT_MAP) of een uitsnede rond center (FOLLOW)
+    visibleHalfWidth = worldWidth;
+    visibleHalfHeight = worldHeight;
+    if (mode == CameraMode::FOLLOW) {
+        visibleHalfHeight = std::min(worldHeight, followSettings.visibleRows * getTileWorldSize() / 2.0f);
+        visibleHalfWidth = std::min(worldWidth, visibleHalfHeight * followSettings.maxAspect);
+    }
+
     // World size
-    float worldPixelWidth = 2.0f * worldWidth;
-    float worldPixelHeight = 2.0f * worldHeight;
+    float worldPixelWidth = 2.0f * visibleHalfWidth;
+    float worldPixelHeight = 2.0f * visibleHalfHeight;
 
     // Aspect ratios
     float windowAspect = static_cast<float>(windowWidth) / windowHeight;
@@ -45,25 +54,91 @@ void Camera::calculateScale() {
         viewportOffsetX = 0.0f;
         viewportOffsetY = (windowHeight - viewportHeight) / 2.0f;
     }
+
+    center = clampCenter(center);
+}
+
+Position Camera::clampCenter(const Position& desired) const {
+    auto clampAxis = [](float value, float worldHalf, float visibleHalf) {
+        float limit = worldHalf - visibleHalf;
+        return limit <= 0.0f ? 0.0f : std::clamp(value, -limit, limit);
+    };
+    return Position(clampAxis(desired.x, worldWidth, visibleHalfWidth),
+                    clampAxis(desired.y, worldHeight, visibleHalfHeight));
+}
+
+void Camera::setMode(CameraMode newMode) {
+    mode = newMode;
+    if (mode == CameraMode::FIT_MAP) {
+        center = Position(0.0f, 0.0f);
+    }
+    calculateScale();
+}
+
+void Camera::setFollowSettings(const CameraFollowSettings& settings) {
+    followSettings = settings;
+    calculateScale();
+}
+
+void Camera::update(const Position& target, float deltaTime) {
+    if (mode != CameraMode::FOLLOW) return;
+
+    // Dead zone: enkel bijsturen tot het target terug op de rand van de zone staat
+    auto followAxis = [](float current, float targetValue, float zone) {
+        if (targetValue > current + zone) return targetValue - zone;
+        if (targetValue < current - zone) return targetValue + zone;
+        return current;
+    };
+    Position desired(followAxis(center.x, target.x, visibleHalfWidth * followSettings.deadZone),
+                     followAxis(center.y, target.y, visibleHalfHeight * followSettings.deadZone));
+    desired = clampCenter(desired);
+
+    // Exponentiële smoothing: zelfde traject bij 30 of 144 fps
+    float blend = followSettings.smoothing > 0.0f ? 1.0f - std::exp(-followSettings.smoothing * deltaTime) : 1.0f;
+    center.x += (desired.x - center.x) * blend;
+    center.y += (desired.y - center.y) * blend;
+}
+
+void Camera::snapTo(const Position& target) {
+    if (mode != CameraMode::FOLLOW) return;
+    center = clampCenter(target);
 }
 
 Position Camera::worldToScreen(const Position& worldPos) const {
     // MAP NAAR VIEWPORT + OFFSET
-    float screenX = viewportOffsetX + (viewportWidth / 2.0f) + worldPos.x * scale;
-    float screenY = viewportOffsetY + (viewportHeight / 2.0f) + worldPos.y * scale;
+    float screenX = viewportOffsetX + (viewportWidth / 2.0f) + (worldPos.x - center.x) * scale;
+    float screenY = viewportOffsetY + (viewportHeight / 2.0f) + (worldPos.y - center.y) * scale;
 
     return Position(screenX, screenY);
 }
 
 Position Camera::screenToWorld(int screenX, int screenY) const {
-    float worldX = (screenX - viewportOffsetX - viewportWidth / 2.0f) / scale;
-    float worldY = (screenY - viewportOffsetY - viewportHeight / 2.0f) / scale;
+    float worldX = (screenX - viewportOffsetX - viewportWidth / 2.0f) / scale + center.x;
+    float worldY = (screenY - viewportOffsetY - viewportHeight / 2.0f) / scale + center.y;
     return Position(worldX, worldY);
 }
 
 float Camera::getSpriteSize() const {
-    const float approximateTileSize = 2.0f * worldHeight / mapRows;
-    return scale * approximateTileSize * 0.91f;
+    return scale * getTileWorldSize() * 0.91f;
+}
+
+CameraTransform Camera::getTransform() const {
+    CameraTransform transform;
+    transform.screenCenterX = viewportOffsetX + (viewportWidth / 2.0f);
+    transform.screenCenterY = viewportOffsetY + (viewportHeight / 2.0f);
+    transform.centerX = center.x;
+    transform.centerY = center.y;
+    transform.scale = scale;
+    transform.spriteSize = getSpriteSize();
+    transform.tileSize = getTileWorldSize();
+    transform.visibleHalfWidth = visibleHalfWidth;
+    transform.visibleHalfHeight = visibleHalfHeight;
+    return transform;
+}
+
+BoundingBox Camera::getVisibleWorldBounds() const {
+    return BoundingBox(center.x - visibleHalfWidth, center.y - visibleHalfHeight,
+                       2.0f * visibleHalfWidth, 2.0f * visibleHalfHeight);
 }
 
 void Camera::setWindowSize(int width, int height) {
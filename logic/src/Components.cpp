@@ -0,0 +1,50 @@
+#include "logic/Components.h"
+
+namespace pacman {
+
+void CollectibleArrays::clear() {
+    transforms.clear();
+    colliders.clear();
+    states.clear();
+    remaining = 0;
+}
+
+void CollectibleArrays::add(const Position& pos, CollectibleKind kind, std::int32_t points) {
+    transforms.push_back({pos});
+    colliders.push_back({});
+    states.push_back({points, kind, false});
+    ++remaining;
+}
+
+void CollectibleArrays::setRadius(float radius) {
+    for (Collider& collider : colliders) {
+        collider.radius = radius;
+    }
+}
+
+bool CollectibleArrays::collect(std::size_t index) {
+    Collectible& state = states[index];
+    if (state.collected) return false;
+
+    state.collected = true;
+    --remaining;
+    return true;
+}
+
+void ComponentStore::clear() {
+    wallTransforms.clear();
+    wallRadius = 0.0f;
+    coins.clear();
+    fruits.clear();
+}
+
+std::size_t ComponentStore::getMemoryUsage() const {
+    auto arrays = [](const CollectibleArrays& a) {
+        return a.transforms.capacity() * sizeof(Transform) +
+               a.colliders.capacity() * sizeof(Collider) +
+               a.states.capacity() * sizeof(Collectible);
+    };
+    return wallTransforms.capacity() * sizeof(Transform) + arrays(coins) + arrays(fruits);
+}
+
+} // namespace pacman
@@ -0,0 +1,42 @@
+#include "logic/EntityRegistry.h"
+
+namespace pacman {
+
+EntityHandle EntityRegistry::add(EntityModel& entity) {
+    std::uint32_t index;
+    if (freeHead != EntityHandle::INVALID_INDEX) {
+        index = freeHead;
+        freeHead = slots[index].nextFree;
+    } else {
+        index = static_cast<std::uint32_t>(slots.size());
+        slots.emplace_back();
+    }
+
+    Slot& slot = slots[index];
+    slot.entity = &entity;
+    slot.nextFree = EntityHandle::INVALID_INDEX;
+    ++liveCount;
+
+    return {index, slot.generation};
+}
+
+void EntityRegistry::remove(EntityHandle handle) {
+    if (!contains(handle)) return;
+
+    Slot& slot = slots[handle.index];
+    slot.entity = nullptr;
+    // Generation 0 is gereserveerd voor ongeldige handles
+    if (++slot.generation == 0) {
+        slot.generation = 1;
+    }
+    slot.nextFree = freeHead;
+    freeHead = handle.index;
+    --liveCount;
+}
+
+void EntityRegistry::relocate(EntityHandle handle, EntityModel& entity) {
+    if (!contains(handle)) return;
+    slots[handle.index].entity = &entity;
+}
+
+} // namespace pacman
@@ -0,0 +1,446 @@
+#include "logic/GhostSystem.h"
+#include "logic/World.h"
+#include "logic/entities/Ghost.h"
+#include "logic/utils/Profiler.h"
+#include "logic/utils/Random.h"
+#include <cmath>
+#include <cstdlib>
+#include <limits>
+
+namespace pacman {
+
+namespace {
+
+// getDirectionVector als tabellen (index = Direction), bruikbaar in vectorizable loops
+constexpr float DIR_X[5] = {0.0f, 0.0f, 0.0f, -1.0f, 1.0f};
+constexpr float DIR_Y[5] = {0.0f, -1.0f, 1.0f, 0.0f, 0.0f};
+
+constexpr Direction ALL_DIRECTIONS[4] = {
+    Direction::UP, Direction::DOWN, Direction::LEFT, Direction::RIGHT
+};
+
+bool isHorizontal(Direction dir) {
+    return dir == Direction::LEFT || dir == Direction::RIGHT;
+}
+
+bool isVertical(Direction dir) {
+    return dir == Direction::UP || dir == Direction::DOWN;
+}
+
+Direction getOppositeDirection(Direction dir) {
+    switch (dir) {
+        case Direction::UP:    return Direction::DOWN;
+        case Direction::DOWN:  return Direction::UP;
+        case Direction::LEFT:  return Direction::RIGHT;
+        case Direction::RIGHT: return Direction::LEFT;
+        default:               return Direction::NONE;
+    }
+}
+
+bool isOpposite(Direction dir1, Direction dir2) {
+    return dir1 != Direction::NONE && dir1 == getOppositeDirection(dir2);
+}
+
+float calculateManhattanDistance(const Position& from, const Position& to) {
+    return std::abs(from.x - to.x) + std::abs(from.y - to.y);
+}
+
+} // namespace
+
+GhostSystem::GhostSystem(World& world) : world(world) {}
+
+std::size_t GhostSystem::add(Ghost* facade, const Position& spawnPos, float spawnDelay) {
+    posX.push_back(spawnPos.x);
+    posY.push_back(spawnPos.y);
+    directions.push_back(Direction::RIGHT);
+    speeds.push_back(facade->getSpeed());
+    normalSpeeds.push_back(facade->getSpeed());
+    radii.push_back(facade->collisionRadius);
+    scaredTimers.push_back(0.0f);
+    spawnTimers.push_back(spawnDelay);
+    states.push_back(GhostState::IN_SPAWN);
+    previousStates.push_back(GhostState::ON_MAP);
+    passedDoor.push_back(0);
+    latticePositions.push_back(LatticePosition{});
+    latticeCarries.push_back(0);
+
+    spawnX.push_back(spawnPos.x);
+    spawnY.push_back(spawnPos.y);
+    initialSpawnDelays.push_back(spawnDelay);
+    facades.push_back(facade);
+
+    inSpawn.push_back(0);
+    steps.push_back(0.0f);
+
+    return facades.size() - 1;
+}
+
+void GhostSystem::remove(std::size_t slot) {
+    std::size_t last = facades.size() - 1;
+
+    // Swap-remove: laatste ghost vult het gat, zijn facade krijgt het nieuwe slot
+    auto moveLast = [slot, last](auto& values) {
+        values[slot] = values[last];
+        values.pop_back();
+    };
+
+    moveLast(posX);
+    moveLast(posY);
+    moveLast(directions);
+    moveLast(speeds);
+    moveLast(normalSpeeds);
+    moveLast(radii);
+    moveLast(scaredTimers);
+    moveLast(spawnTimers);
+    moveLast(states);
+    moveLast(previousStates);
+    moveLast(passedDoor);
+    moveLast(latticePositions);
+    moveLast(latticeCarries);
+    moveLast(spawnX);
+    moveLast(spawnY);
+    moveLast(initialSpawnDelays);
+    moveLast(facades);
+    moveLast(inSpawn);
+    moveLast(steps);
+
+    if (slot < facades.size()) {
+        facades[slot]->slot = slot;
+    }
+}
+
+void GhostSystem::update(float deltaTime) {
+    updateRange(0, facades.size(), deltaTime);
+}
+
+void GhostSystem::updateRange(std::size_t begin, std::size_t end, float deltaTime) {
+    PACMAN_PROFILE_SCOPE("GhostSystem::update");
+
+    // === 1. Timers (branchless) ===
+    // Spawn conditie hangt niet af van het aflopen van scared mode
+    // (state wordt dan previousState), dus beide timers in één pass
+    for (std::size_t i = begin; i < end; ++i) {
+        bool scared = states[i] == GhostState::SCARED;
+        bool spawning = states[i] == GhostState::IN_SPAWN || previousStates[i] == GhostState::IN_SPAWN;
+
+        scaredTimers[i] -= scared ? deltaTime : 0.0f;
+        spawnTimers[i] -= spawning ? deltaTime : 0.0f;
+        inSpawn[i] = spawning ? 1 : 0;
+    }
+
+    // === 2. State transitions ===
+    for (std::size_t i = begin; i < end; ++i) {
+        if (states[i] == GhostState::SCARED && scaredTimers[i] <= 0.0f) {
+            states[i] = previousStates[i];
+            speeds[i] = normalSpeeds[i];
+            notifyStateChanged(i);
+        }
+
+        if (inSpawn[i] && spawnTimers[i] <= 0.0f) {
+            // Ghost mag spawn verlaten
+            if (states[i] == GhostState::SCARED) {
+                // Als nog scared, ga naar ON_MAP maar blijf scared
+                previousStates[i] = GhostState::ON_MAP;
+            } else {
+                states[i] = GhostState::ON_MAP;
+                notifyStateChanged(i);
+            }
+        }
+    }
+
+    // === 3. Movement stap (vectorizable) ===
+    // direction * (speed * dt) == (direction * speed) * dt: exact bij eenheidsvectoren
+    for (std::size_t i = begin; i < end; ++i) {
+        steps[i] = inSpawn[i] ? 0.0f : speeds[i] * deltaTime;
+    }
+
+    // === 4. Decisions + resolve per ghost (zelfde volgorde van Random draws als voorheen) ===
+    const bool lattice = onLattice();
+    const std::int64_t micros = lattice ? TileLattice::toMicros(deltaTime) : 0;
+
+    for (std::size_t i = begin; i < end; ++i) {
+        if (!inSpawn[i]) {
+            if (lattice) {
+                moveOnLattice(i, micros);
+            } else {
+                moveContinuous(i);
+            }
+
+            if (!passedDoor[i] && world.hasDoorInMap()) {
+                auto ghostGrid = world.worldToGrid(positionOf(i));
+                auto doorGrid = world.getDoorGridPosition();
+
+                if (ghostGrid.row == doorGrid.row - 1 && ghostGrid.col == doorGrid.col) {
+                    passedDoor[i] = 1;
+                }
+            }
+        }
+
+        if (!lattice) wrapAround(i);  // Lattice wrapt zelf (integer)
+        syncFacade(i);
+
+        Event event;
+        event.type = EventType::ENTITY_UPDATED;
+        event.deltaTime = deltaTime;
+        facades[i]->notify(event);
+    }
+}
+
+void GhostSystem::decide(std::size_t slot) {
+    if (isAtIntersection(slot)) {
+        Direction newDir;
+        if (states[slot] == GhostState::SCARED && world.getPacMan()) {
+            newDir = getBestDirectionToTarget(slot, world.getPacMan()->getPosition(), true);
+        } else {
+            newDir = facades[slot]->chooseDirection();
+        }
+
+        if (newDir != Direction::NONE && newDir != directions[slot]) {
+            directions[slot] = newDir;
+        }
+    }
+}
+
+void GhostSystem::moveContinuous(std::size_t slot) {
+    decide(slot);
+
+    auto dir = static_cast<int>(directions[slot]);
+    float moveX = DIR_X[dir] * steps[slot];
+    float moveY = DIR_Y[dir] * steps[slot];
+
+    // Swept: bij een botsing tot tegen de wall, daarna nieuwe direction
+    if (isHorizontal(directions[slot])) {
+        float travel = world.sweepWalls(positionOf(slot), radii[slot], directions[slot], steps[slot], facades[slot]);
+        if (travel >= steps[slot]) {
+            posX[slot] += moveX;
+        } else {
+            posX[slot] += DIR_X[dir] * travel;
+            handleWallCollision(slot);
+        }
+    }
+
+    // Ook na een horizontale botsing die naar UP/DOWN draaide (zoals Ghost::move voorheen)
+    if (isVertical(directions[slot])) {
+        // Na een draai is moveY 0 (stap hoort bij de oude direction)
+        float distance = std::abs(moveY);
+        float travel = world.sweepWalls(positionOf(slot), radii[slot], directions[slot], distance, facades[slot]);
+        if (travel >= distance) {
+            posY[slot] += moveY;
+        } else {
+            posY[slot] += DIR_Y[static_cast<int>(directions[slot])] * travel;
+            handleWallCollision(slot);
+        }
+    }
+}
+
+void GhostSystem::moveOnLattice(std::size_t slot, std::int64_t micros) {
+    const TileLattice& lattice = world.getTileLattice();
+
+    // Extern verplaatst (reset, respawn, setPosition): snap naar tile center
+    Position expected = lattice.toWorld(latticePositions[slot]);
+    if (expected.x != posX[slot] || expected.y != posY[slot]) {
+        latticePositions[slot] = lattice.snap(positionOf(slot));
+        latticeCarries[slot] = 0;
+    }
+
+    std::int32_t distance = TileLattice::stepFor(lattice.subtilesPerSecond(speeds[slot]), micros,
+                                                 latticeCarries[slot]);
+
+    lattice.advance(latticePositions[slot], directions[slot], distance, passedDoor[slot] != 0,
+                    [this, slot, &lattice](const LatticePosition& at, Direction) {
+                        // AI leest de float positie: eerst syncen
+                        Position atWorld = lattice.toWorld(at);
+                        posX[slot] = atWorld.x;
+                        posY[slot] = atWorld.y;
+
+                        decide(slot);
+                        if (!canMove(slot, directions[slot])) {
+                            handleWallCollision(slot);
+                        }
+                        return directions[slot];
+                    });
+
+    Position moved = lattice.toWorld(latticePositions[slot]);
+    posX[slot] = moved.x;
+    posY[slot] = moved.y;
+}
+
+bool GhostSystem::onLattice() const {
+    return world.getMovementMode() == MovementMode::TILE_LATTICE && !world.getTileLattice().empty();
+}
+
+bool GhostSystem::canMove(std::size_t slot, Direction dir) const {
+    if (onLattice()) {
+        return world.getTileLattice().canEnter(latticePositions[slot], dir, passedDoor[slot] != 0);
+    }
+    return world.canMoveInDirection(positionOf(slot), dir, radii[slot], facades[slot]);
+}
+
+bool GhostSystem::isAtIntersection(std::size_t slot) const {
+    int viableCount = 0;
+
+    for (Direction dir : ALL_DIRECTIONS) {
+        if (canMove(slot, dir)) {
+            viableCount++;
+        }
+    }
+
+    return viableCount >= 3;
+}
+
+std::vector<Direction> GhostSystem::getViableDirections(std::size_t slot) const {
+    std::vector<Direction> viable;
+
+    for (Direction dir : ALL_DIRECTIONS) {
+        if (isOpposite(dir, directions[slot])) continue;
+        if (canMove(slot, dir)) {
+            viable.push_back(dir);
+        }
+    }
+
+    return viable;
+}
+
+Direction GhostSystem::getBestDirectionToTarget(std::size_t slot, const Position& target, bool maximize) const {
+    auto viable = getViableDirections(slot);
+    if (viable.empty()) return directions[slot];
+
+    Position pos = positionOf(slot);
+    Direction bestDir = viable[0];
+    float bestDistance = maximize ? -999999.0f : 999999.0f;
+
+    if (onLattice()) {
+        // Integer Manhattan afstand vanaf het center van de buur tile
+        const TileLattice& lattice = world.getTileLattice();
+        LatticePosition from = latticePositions[slot];
+        LatticePosition to = lattice.toLattice(target);
+        std::int64_t bestLatticeDistance = maximize ? -1 : std::numeric_limits<std::int64_t>::max();
+
+        for (Direction dir : viable) {
+            Position step = getDirectionVector(dir);
+            std::int64_t dx = from.x + static_cast<std::int32_t>(step.x) * TileLattice::SUBTILES - to.x;
+            std::int64_t dy = from.y + static_cast<std::int32_t>(step.y) * TileLattice::SUBTILES - to.y;
+            std::int64_t dist = std::abs(dx) + std::abs(dy);
+
+            if (maximize ? dist > bestLatticeDistance : dist < bestLatticeDistance) {
+                bestLatticeDistance = dist;
+                bestDir = dir;
+            }
+        }
+        return bestDir;
+    }
+
+    for (Direction dir : viable) {
+        Position testPos = pos + getDirectionVector(dir) * 0.1f;
+        float dist = calculateManhattanDistance(testPos, target);
+
+        if (maximize ? dist > bestDistance : dist < bestDistance) {
+            bestDistance = dist;
+            bestDir = dir;
+        }
+    }
+
+    return bestDir;
+}
+
+void GhostSystem::handleWallCollision(std::size_t slot) {
+    std::vector<Direction> viable;
+
+    for (Direction dir : ALL_DIRECTIONS) {
+        if (isOpposite(dir, directions[slot])) continue;
+        if (canMove(slot, dir)) {
+            viable.push_back(dir);
+        }
+    }
+
+    if (!viable.empty()) {
+        int index = Random::getInstance().getInt(0, viable.size() - 1);
+        directions[slot] = viable[index];
+    } else {
+        directions[slot] = getOppositeDirection(directions[slot]);
+    }
+}
+
+void GhostSystem::wrapAround(std::size_t slot) {
+    auto dims = world.getMapDimensions();
+    if (dims.rows == 0) return;
+
+    float worldWidth = static_cast<float>(dims.cols) / static_cast<float>(dims.rows);
+    const float THRESHOLD = 0.05f;
+
+    if (posX[slot] > worldWidth - THRESHOLD) {
+        posX[slot] = -worldWidth + THRESHOLD;
+    } else if (posX[slot] < -worldWidth + THRESHOLD) {
+        posX[slot] = worldWidth - THRESHOLD;
+    }
+}
+
+void GhostSystem::enterScaredMode(std::size_t slot, float duration) {
+    if (states[slot] != GhostState::SCARED) {
+        previousStates[slot] = states[slot];
+    }
+
+    states[slot] = GhostState::SCARED;
+    scaredTimers[slot] = duration;
+    speeds[slot] = normalSpeeds[slot] * 0.5f;
+
+    if (previousStates[slot] == GhostState::ON_MAP) {
+        directions[slot] = getOppositeDirection(directions[slot]);
+    }
+
+    syncFacade(slot);
+    notifyStateChanged(slot);
+}
+
+void GhostSystem::respawn(std::size_t slot) {
+    posX[slot] = spawnX[slot];
+    posY[slot] = spawnY[slot];
+    directions[slot] = Direction::RIGHT;
+    states[slot] = GhostState::ON_MAP;  // Direct op map
+    speeds[slot] = normalSpeeds[slot];
+    passedDoor[slot] = 0;
+    scaredTimers[slot] = 0.0f;
+    spawnTimers[slot] = 0.0f;  // Geen delay
+
+    syncFacade(slot);
+    notifyStateChanged(slot);
+}
+
+void GhostSystem::reset(std::size_t slot) {
+    posX[slot] = spawnX[slot];
+    posY[slot] = spawnY[slot];
+    directions[slot] = Direction::RIGHT;
+    states[slot] = GhostState::IN_SPAWN;  // In spawn met delay
+    speeds[slot] = normalSpeeds[slot];
+    passedDoor[slot] = 0;
+    scaredTimers[slot] = 0.0f;
+    spawnTimers[slot] = initialSpawnDelays[slot];
+
+    syncFacade(slot);
+    notifyStateChanged(slot);
+}
+
+void GhostSystem::setPosition(std::size_t slot, const Position& pos) {
+    posX[slot] = pos.x;
+    posY[slot] = pos.y;
+    syncFacade(slot);
+}
+
+void GhostSystem::setSpeed(std::size_t slot, float speed) {
+    speeds[slot] = speed;
+    syncFacade(slot);
+}
+
+void GhostSystem::syncFacade(std::size_t slot) {
+    Ghost* facade = facades[slot];
+    facade->position = Position(posX[slot], posY[slot]);
+    facade->speed = speeds[slot];
+}
+
+void GhostSystem::notifyStateChanged(std::size_t slot) {
+    Event event;
+    event.type = EventType::GHOST_STATE_CHANGED;
+    facades[slot]->notify(event);
+}
+
+} // namespace pacman
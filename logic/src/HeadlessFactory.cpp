@@ -0,0 +1,39 @@
+#include "logic/HeadlessFactory.h"
+#include "logic/entities/PacMan.h"
+#include "logic/entities/Coin.h"
+#include "logic/entities/Fruit.h"
+#include "logic/entities/Wall.h"
+#include "logic/entities/RedGhost.h"
+#include "logic/entities/PinkGhost.h"
+#include "logic/entities/BlueGhost.h"
+#include "logic/entities/OrangeGhost.h"
+
+namespace pacman {
+
+EntityPtr<PacMan> HeadlessFactory::createPacMan(const Position& pos) {
+    return makeModel<PacMan>(pos);
+}
+
+EntityPtr<Coin> HeadlessFactory::createCoin(const Position& pos) {
+    return makeModel<Coin>(pos);
+}
+
+EntityPtr<Fruit> HeadlessFactory::createFruit(const Position& pos) {
+    return makeModel<Fruit>(pos);
+}
+
+EntityPtr<Wall> HeadlessFactory::createWall(const Position& pos) {
+    return makeModel<Wall>(pos);
+}
+
+EntityPtr<Ghost> HeadlessFactory::createGhost(World& world, const Position& pos, GhostColor color) {
+    switch (color) {
+    case GhostColor::RED:    return makeModel<RedGhost>(world, pos);
+    case GhostColor::PINK:   return makeModel<PinkGhost>(world, pos);
+    case GhostColor::BLUE:   return makeModel<BlueGhost>(world, pos);
+    case GhostColor::ORANGE: return makeModel<OrangeGhost>(world, pos);
+    }
+    return nullptr;
+}
+
+} // namespace pacman
@@ -0,0 +1,149 @@
+#include "logic/HighScoreService.h"
+#include <algorithm>
+#include <cstdio>
+#include <exception>
+#include <fstream>
+#include <iostream>
+
+namespace pacman {
+
+HighScoreService::~HighScoreService() {
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    writeRequested.notify_one();
+    if (writer.joinable()) {
+        writer.join();  // writerLoop schrijft eerst de laatste versie weg
+    }
+}
+
+void HighScoreService::setFile(const std::string& file) {
+    std::lock_guard<std::mutex> lock(mutex);
+    filename = file;
+    loaded = false;
+}
+
+void HighScoreService::load() {
+    std::lock_guard<std::mutex> lock(mutex);
+    loadLocked();
+}
+
+void HighScoreService::loadLocked() {
+    if (loaded) return;
+
+    entries = readFile(filename);
+    while (entries.size() < MAX_ENTRIES) {
+        entries.emplace_back("---", 0);
+    }
+    loaded = true;
+}
+
+std::vector<HighScoreEntry> HighScoreService::getHighScores() {
+    std::lock_guard<std::mutex> lock(mutex);
+    loadLocked();
+    return entries;
+}
+
+bool HighScoreService::isHighScore(int score) {
+    std::lock_guard<std::mutex> lock(mutex);
+    loadLocked();
+    if (entries.size() < MAX_ENTRIES) return true;
+    return score > entries.back().score;
+}
+
+void HighScoreService::submit(const std::string& playerName, int score) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        loadLocked();
+
+        entries.emplace_back(playerName, score);
+        std::stable_sort(entries.begin(), entries.end(),
+            [](const HighScoreEntry& a, const HighScoreEntry& b) {
+                return a.score > b.score;
+            });
+
+        if (entries.size() > MAX_ENTRIES) {
+            entries.erase(entries.begin() + MAX_ENTRIES, entries.end());
+        }
+
+        ++version;
+        if (!writer.joinable()) {
+            writer = std::thread(&HighScoreService::writerLoop, this);
+        }
+    }
+    writeRequested.notify_one();
+}
+
+void HighScoreService::flush() {
+    std::unique_lock<std::mutex> lock(mutex);
+    writeCompleted.wait(lock, [this] { return writtenVersion == version; });
+}
+
+void HighScoreService::writerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        writeRequested.wait(lock, [this] { return stopping || writtenVersion != version; });
+        if (writtenVersion == version) {
+            return;  // stopping en niets meer te schrijven
+        }
+
+        // Kopie van de laatste stand; schrijven zonder lock (queries blijven snel)
+        std::uint64_t target = version;
+        std::vector<HighScoreEntry> snapshot = entries;
+        std::string file = filename;
+
+        lock.unlock();
+        if (!writeFile(file, snapshot)) {
+            std::cerr << "Warning: Failed to save highscores to: " << file << std::endl;
+        }
+        lock.lock();
+
+        writtenVersion = target;
+        writeCompleted.notify_all();
+    }
+}
+
+std::vector<HighScoreEntry> HighScoreService::readFile(const std::string& filename) {
+    std::vector<HighScoreEntry> result;
+
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "Warning: Highscores file couldn't open: " << filename << std::endl;
+        return result;
+    }
+
+    std::string line;
+    while (std::getline(file, line) && result.size() < MAX_ENTRIES) {
+        size_t commaPos = line.find(',');
+        if (commaPos == std::string::npos) continue;
+
+        try {
+            result.emplace_back(line.substr(0, commaPos), std::stoi(line.substr(commaPos + 1)));
+        } catch (const std::exception&) {
+            std::cerr << "Warning: Skipping invalid highscore line: " << line << std::endl;
+        }
+    }
+
+    return result;
+}
+
+bool HighScoreService::writeFile(const std::string& filename, const std::vector<HighScoreEntry>& entries) {
+    std::string tmpFile = filename + ".tmp";
+    {
+        std::ofstream file(tmpFile, std::ios::trunc);
+        if (!file.is_open()) return false;
+
+        for (const auto& entry : entries) {
+            file << entry.name << "," << entry.score << "\n";
+        }
+        if (!file) return false;
+    }
+    if (std::rename(tmpFile.c_str(), filename.c_str()) == 0) return true;
+
+    // Sommige platformen rename'n niet over een bestaande file
+    std::remove(filename.c_str());
+    return std::rename(tmpFile.c_str(), filename.c_str()) == 0;
+}
+
+} // namespace pacman
@@ -0,0 +1,21 @@
+#include "logic/LevelArena.h"
+
+namespace pacman {
+
+LevelArena::LevelArena(std::size_t initialSize)
+    : resource(initialSize, std::pmr::new_delete_resource()) {
+}
+
+void* LevelArena::allocate(std::size_t size, std::size_t alignment) {
+    bytesAllocated += size;
+    allocationCount++;
+    return resource.allocate(size, alignment);
+}
+
+void LevelArena::release() {
+    resource.release();
+    bytesAllocated = 0;
+    allocationCount = 0;
+}
+
+} // namespace pacman
@@ -0,0 +1,233 @@
+#include "logic/MapGenerator.h"
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <random>
+#include <stdexcept>
+
+namespace pacman {
+
+namespace {
+
+constexpr char WALL = 'x';
+constexpr char CORRIDOR = ' ';   // Coin
+constexpr char EMPTY = '#';      // Geen entity (ghost house interieur)
+
+// std::uniform_*_distribution is implementatie-afhankelijk; mt19937 output niet.
+// Eigen conversies houden maps identiek tussen compilers/platformen.
+class SeededRng {
+public:
+    explicit SeededRng(unsigned int seed) : engine(seed) {}
+
+    // Uniform in [0, bound)
+    std::uint32_t below(std::uint32_t bound) {
+        return static_cast<std::uint32_t>(engine() % bound);
+    }
+
+    // Uniform in [0, 1)
+    float chance() {
+        return static_cast<float>(engine() >> 8) * (1.0f / 16777216.0f);
+    }
+
+private:
+    std::mt19937 engine;
+};
+
+constexpr int DIR_ROW[4] = {-1, 1, 0, 0};
+constexpr int DIR_COL[4] = {0, 0, -1, 1};
+
+} // namespace
+
+int MapGenerator::maxGhosts(int cols) {
+    // Ring (houseHalf + 2) moet binnen de border passen
+    int clampedCols = std::clamp(cols, MapGeneratorConfig::MIN_SIZE, MapGeneratorConfig::MAX_SIZE);
+    return 2 * (clampedCols / 2 - 3);
+}
+
+MapGenerator::MapGenerator(const MapGeneratorConfig& config) : config(config) {
+    this->config.rows = std::clamp(config.rows, MapGeneratorConfig::MIN_SIZE, MapGeneratorConfig::MAX_SIZE);
+    this->config.cols = std::clamp(config.cols, MapGeneratorConfig::MIN_SIZE, MapGeneratorConfig::MAX_SIZE);
+    this->config.ghostCount = std::clamp(config.ghostCount, 0, maxGhosts(this->config.cols));
+    this->config.fruitDensity = std::clamp(config.fruitDensity, 0.0f, 1.0f);
+    this->config.braidFactor = std::clamp(config.braidFactor, 0.0f, 1.0f);
+}
+
+std::vector<std::string> MapGenerator::generate() const {
+    const int rows = config.rows;
+    const int cols = config.cols;
+    SeededRng rng(config.seed);
+
+    std::vector<std::string> map(rows, std::string(cols, WALL));
+
+    // === 1. Perfecte maze (iteratieve recursive backtracker) ===
+    // Cel (cr, cc) ligt op tile (2cr+1, 2cc+1); border blijft altijd muur
+    const int cellRows = (rows - 1) / 2;
+    const int cellCols = (cols - 1) / 2;
+
+    std::vector<char> visited(static_cast<std::size_t>(cellRows) * cellCols, 0);
+    std::vector<int> stack;
+    stack.reserve(visited.size());
+
+    int startCell = static_cast<int>(rng.below(static_cast<std::uint32_t>(visited.size())));
+    visited[startCell] = 1;
+    map[2 * (startCell / cellCols) + 1][2 * (startCell % cellCols) + 1] = CORRIDOR;
+    stack.push_back(startCell);
+
+    while (!stack.empty()) {
+        int cell = stack.back();
+        int cr = cell / cellCols;
+        int cc = cell % cellCols;
+
+        int options[4];
+        int optionCount = 0;
+        for (int d = 0; d < 4; ++d) {
+            int nr = cr + DIR_ROW[d];
+            int nc = cc + DIR_COL[d];
+            if (nr < 0 || nr >= cellRows || nc < 0 || nc >= cellCols) continue;
+            if (!visited[nr * cellCols + nc]) options[optionCount++] = d;
+        }
+
+        if (optionCount == 0) {
+            stack.pop_back();
+            continue;
+        }
+
+        int d = options[rng.below(static_cast<std::uint32_t>(optionCount))];
+        int nr = cr + DIR_ROW[d];
+        int nc = cc + DIR_COL[d];
+
+        map[2 * cr + 1 + DIR_ROW[d]][2 * cc + 1 + DIR_COL[d]] = CORRIDOR;  // Muur ertussen
+        map[2 * nr + 1][2 * nc + 1] = CORRIDOR;
+
+        visited[nr * cellCols + nc] = 1;
+        stack.push_back(nr * cellCols + nc);
+    }
+
+    // === 2. Braiding: dead ends openen naar een buurcel ===
+    for (int cr = 0; cr < cellRows; ++cr) {
+        for (int cc = 0; cc < cellCols; ++cc) {
+            int r = 2 * cr + 1;
+            int c = 2 * cc + 1;
+
+            int openCount = 0;
+            int closed[4];
+            int closedCount = 0;
+            for (int d = 0; d < 4; ++d) {
+                if (map[r + DIR_ROW[d]][c + DIR_COL[d]] != WALL) {
+                    openCount++;
+                    continue;
+                }
+                int nr = cr + DIR_ROW[d];
+                int nc = cc + DIR_COL[d];
+                if (nr >= 0 && nr < cellRows && nc >= 0 && nc < cellCols) {
+                    closed[closedCount++] = d;
+                }
+            }
+
+            if (openCount != 1 || closedCount == 0) continue;
+            if (rng.chance() >= config.braidFactor) continue;
+
+            int d = closed[rng.below(static_cast<std::uint32_t>(closedCount))];
+            map[r + DIR_ROW[d]][c + DIR_COL[d]] = CORRIDOR;
+        }
+    }
+
+    // === 3. Ghost house (3 hoog) met corridor ring in het centrum ===
+    // Interieur: houseHalf tiles links en rechts van de (lege) tile onder de deur
+    const int houseRow = rows / 2;
+    const int houseCol = cols / 2;
+    const int houseHalf = std::max(2, (config.ghostCount + 1) / 2);
+
+    for (int r = houseRow - 2; r <= houseRow + 2; ++r) {
+        for (int c = houseCol - houseHalf - 2; c <= houseCol + houseHalf + 2; ++c) {
+            bool ring = (r == houseRow - 2 || r == houseRow + 2 ||
+                         c == houseCol - houseHalf - 2 || c == houseCol + houseHalf + 2);
+            map[r][c] = ring ? CORRIDOR : WALL;
+        }
+    }
+
+    for (int c = houseCol - houseHalf; c <= houseCol + houseHalf; ++c) {
+        map[houseRow][c] = EMPTY;
+    }
+    map[houseRow - 1][houseCol] = config.door ? 'd' : EMPTY;
+
+    // Eerste 4 zoals map_big.txt ("ri#ob"), daarna 'g' (personality via World's GhostRoster)
+    const char classicChars[4] = {'r', 'i', 'b', 'o'};
+    std::vector<int> ghostCols;
+    for (int c = houseCol - houseHalf; c <= houseCol + houseHalf; ++c) {
+        if (c != houseCol) ghostCols.push_back(c);
+    }
+    for (int g = 0; g < config.ghostCount; ++g) {
+        map[houseRow][ghostCols[g]] = g < 4 ? classicChars[g] : 'g';
+    }
+
+    // === 4. PacMan spawn onder het ghost house ===
+    const int spawnRow = houseRow + 2;
+    const int spawnCol = houseCol;
+    map[spawnRow][spawnCol] = 'p';
+
+    // === 5. Flood fill: onbereikbare corridors worden muur ===
+    std::vector<char> reachable(static_cast<std::size_t>(rows) * cols, 0);
+    std::vector<int> frontier;
+    frontier.push_back(spawnRow * cols + spawnCol);
+    reachable[spawnRow * cols + spawnCol] = 1;
+
+    while (!frontier.empty()) {
+        int tile = frontier.back();
+        frontier.pop_back();
+        int r = tile / cols;
+        int c = tile % cols;
+
+        for (int d = 0; d < 4; ++d) {
+            int nr = r + DIR_ROW[d];
+            int nc = c + DIR_COL[d];
+            if (nr < 0 || nr >= rows || nc < 0 || nc >= cols) continue;
+            if (map[nr][nc] != CORRIDOR) continue;  // Ghost house via deur telt niet
+            if (reachable[nr * cols + nc]) continue;
+
+            reachable[nr * cols + nc] = 1;
+            frontier.push_back(nr * cols + nc);
+        }
+    }
+
+    std::vector<int> corridors;
+    for (int r = 0; r < rows; ++r) {
+        for (int c = 0; c < cols; ++c) {
+            if (map[r][c] != CORRIDOR) continue;
+            if (reachable[r * cols + c]) {
+                corridors.push_back(r * cols + c);
+            } else {
+                map[r][c] = WALL;
+            }
+        }
+    }
+
+    // === 6. Fruit ===
+    int fruitCount = 0;
+    for (int tile : corridors) {
+        if (rng.chance() < config.fruitDensity) {
+            map[tile / cols][tile % cols] = 'c';
+            fruitCount++;
+        }
+    }
+
+    if (fruitCount == 0 && config.fruitDensity > 0.0f && !corridors.empty()) {
+        int tile = corridors[rng.below(static_cast<std::uint32_t>(corridors.size()))];
+        map[tile / cols][tile % cols] = 'c';
+    }
+
+    return map;
+}
+
+void MapGenerator::writeToFile(const std::vector<std::string>& mapData, const std::string& filename) {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("Failed to open map file for writing: " + filename);
+    }
+
+    for (const auto& row : mapData) {
+        file << row << "\n";
+    }
+}
+
+} // namespace pacman
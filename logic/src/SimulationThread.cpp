@@ -0,0 +1,128 @@
+#include "logic/SimulationThread.h"
+#include "logic/World.h"
+#include "logic/utils/Profiler.h"
+#include <chrono>
+
+namespace pacman {
+
+SimulationThread::SimulationThread(World& world, float tickSeconds, float readyDuration)
+    : world(world), tickSeconds(tickSeconds), readyDuration(readyDuration) {
+}
+
+SimulationThread::~SimulationThread() {
+    stop();
+}
+
+void SimulationThread::start() {
+    if (thread.joinable()) return;
+
+    wasPlayingDeathAnimation = world.isPlayingDeathAnimation();
+    publishSnapshot();  // Reader heeft meteen een geldige snapshot
+
+    running.store(true, std::memory_order_release);
+    thread = std::thread(&SimulationThread::run, this);
+}
+
+void SimulationThread::stop() {
+    running.store(false, std::memory_order_release);
+    if (thread.joinable()) {
+        thread.join();
+        world.setOwnerThread(std::this_thread::get_id());  // World weer van de caller
+    }
+}
+
+const RenderSnapshot& SimulationThread::acquireSnapshot() {
+    snapshots.acquire();
+    return snapshots.readBuffer();
+}
+
+void SimulationThread::run() {
+    using Clock = std::chrono::steady_clock;
+
+    world.setOwnerThread(std::this_thread::get_id());
+
+    const auto tickDuration = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<float>(tickSeconds));
+    auto nextTick = Clock::now();
+
+    while (running.load(std::memory_order_acquire)) {
+        auto lateness = Clock::now() - nextTick;
+        auto latenessUs = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(lateness).count());
+        if (latenessUs > maxTickLatenessUs.load(std::memory_order_relaxed)) {
+            maxTickLatenessUs.store(latenessUs, std::memory_order_relaxed);
+        }
+
+        drainCommands();
+        if (step()) {
+            publishSnapshot();
+        }
+
+        nextTick += tickDuration;
+
+        // Ver achter (debugger, OS stall): niet alle gemiste ticks inhalen
+        if (Clock::now() - nextTick > tickDuration * MAX_CATCH_UP_TICKS) {
+            nextTick = Clock::now();
+            clockResets.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        std::this_thread::sleep_until(nextTick);
+    }
+}
+
+void SimulationThread::drainCommands() {
+    SimulationCommand command;
+    while (commands.pop(command)) {
+        switch (command.type) {
+        case SimulationCommand::Type::SET_DIRECTION:
+            if (auto* pacman = world.getPacMan()) {
+                pacman->setDirection(command.direction);
+            }
+            break;
+        case SimulationCommand::Type::PAUSE:
+            paused = true;
+            break;
+        case SimulationCommand::Type::RESUME:
+            paused = false;
+            break;
+        }
+    }
+}
+
+bool SimulationThread::step() {
+    if (paused || finished) return false;
+
+    PACMAN_PROFILE_SCOPE("SimulationThread::step");
+
+    bool isDeathAnimPlaying = world.isPlayingDeathAnimation();
+    if (wasPlayingDeathAnimation && !isDeathAnimPlaying) {
+        showingReady = true;
+        readyTimer = 0.0f;
+    }
+    wasPlayingDeathAnimation = isDeathAnimPlaying;
+
+    if (showingReady) {
+        readyTimer += tickSeconds;
+        if (readyTimer >= readyDuration) {
+            showingReady = false;
+        }
+    } else {
+        elapsedTime += tickSeconds;
+    }
+
+    world.update(showingReady ? 0.0f : tickSeconds);
+    ++tick;
+    tickCount.store(tick, std::memory_order_relaxed);
+
+    finished = world.isLevelComplete() || world.isGameOver();
+    return true;
+}
+
+void SimulationThread::publishSnapshot() {
+    RenderSnapshot& snapshot = snapshots.writeBuffer();
+    world.captureSnapshot(snapshot);
+    snapshot.tick = tick;
+    snapshot.elapsedTime = elapsedTime;
+    snapshot.showingReady = showingReady;
+    snapshots.publish();
+}
+
+} // namespace pacman
@@ -0,0 +1,107 @@
+#include "logic/SpatialHash.h"
+#include <algorithm>
+#include <cmath>
+
+namespace pacman {
+
+namespace {
+
+constexpr std::uint32_t MIN_BUCKETS = 16;
+
+std::uint32_t nextPowerOfTwo(std::uint32_t value) {
+    std::uint32_t result = 1;
+    while (result < value) {
+        result <<= 1;
+    }
+    return result;
+}
+
+} // namespace
+
+void SpatialHash::setGrid(float originX, float originY, float cellSize) {
+    this->originX = originX;
+    this->originY = originY;
+    this->cellSize = cellSize;
+    inverseCellSize = 1.0f / cellSize;
+}
+
+void SpatialHash::clear() {
+    staged.clear();
+    entries.clear();
+    bucketStart.clear();
+    bucketMask = 0;
+}
+
+std::int32_t SpatialHash::cellOf(float value, float origin) const {
+    return static_cast<std::int32_t>(std::floor((value - origin) * inverseCellSize));
+}
+
+std::uint32_t SpatialHash::bucketOf(std::int32_t cellX, std::int32_t cellY) const {
+    // Twee grote priemen (Teschner et al.), xor gemengd
+    std::uint32_t hash = static_cast<std::uint32_t>(cellX) * 73856093u ^
+                         static_cast<std::uint32_t>(cellY) * 19349663u;
+    return hash & bucketMask;
+}
+
+void SpatialHash::insert(std::uint32_t id, const Position& pos) {
+    staged.push_back({id, cellOf(pos.x, originX), cellOf(pos.y, originY)});
+}
+
+void SpatialHash::build() {
+    auto bucketCount = nextPowerOfTwo(std::max<std::uint32_t>(MIN_BUCKETS, static_cast<std::uint32_t>(staged.size() * 2)));
+    bucketMask = bucketCount - 1;
+
+    // Counting sort: tel per bucket, prefix sum, verdeel
+    bucketStart.assign(bucketCount + 1, 0);
+    for (const Entry& entry : staged) {
+        bucketStart[bucketOf(entry.cellX, entry.cellY) + 1]++;
+    }
+    for (std::uint32_t b = 0; b < bucketCount; ++b) {
+        bucketStart[b + 1] += bucketStart[b];
+    }
+
+    entries.resize(staged.size());
+    scratchCursor.assign(bucketStart.begin(), bucketStart.end() - 1);
+    for (const Entry& entry : staged) {
+        entries[scratchCursor[bucketOf(entry.cellX, entry.cellY)]++] = entry;
+    }
+
+    staged.clear();
+}
+
+void SpatialHash::query(const BoundingBox& area, std::vector<std::uint32_t>& hits) const {
+    if (entries.empty()) return;
+
+    std::int32_t firstX = cellOf(area.left, originX);
+    std::int32_t lastX = cellOf(area.right(), originX);
+    std::int32_t firstY = cellOf(area.top, originY);
+    std::int32_t lastY = cellOf(area.bottom(), originY);
+
+    // Grote area (meer cellen dan entities): alle entries filteren is goedkoper
+    auto cellCount = static_cast<std::size_t>(lastX - firstX + 1) * static_cast<std::size_t>(lastY - firstY + 1);
+    if (cellCount > entries.size()) {
+        for (const Entry& entry : entries) {
+            if (entry.cellX >= firstX && entry.cellX <= lastX &&
+                entry.cellY >= firstY && entry.cellY <= lastY) {
+                hits.push_back(entry.id);
+            }
+        }
+        return;
+    }
+
+    for (std::int32_t cellY = firstY; cellY <= lastY; ++cellY) {
+        for (std::int32_t cellX = firstX; cellX <= lastX; ++cellX) {
+            std::uint32_t bucket = bucketOf(cellX, cellY);
+
+            // Bucket kan andere cellen bevatten (hash collisions): filter op cel
+            for (std::uint32_t i = bucketStart[bucket]; i < bucketStart[bucket + 1]; ++i) {
+                const Entry& entry = entries[i];
+                if (entry.cellX == cellX && entry.cellY == cellY) {
+                    hits.push_back(entry.id);
+                }
+            }
+        }
+    }
+}
+
+} // namespace pacman
@@ -0,0 +1,114 @@
+#include "logic/TileLattice.h"
+#include <cmath>
+
+namespace pacman {
+
+namespace {
+
+constexpr std::int64_t MICROS_PER_SECOND = 1000000;
+
+} // namespace
+
+void TileLattice::build(int rows, int cols, const std::vector<int>& wallTiles, int doorRow, int doorCol) {
+    this->rows = rows;
+    this->cols = cols;
+    worldWidth = static_cast<float>(cols) / static_cast<float>(rows);
+    tileSize = 2.0f / static_cast<float>(rows);
+
+    cells.assign(static_cast<std::size_t>(rows) * cols, OPEN);
+    for (std::size_t i = 0; i < cells.size() && i < wallTiles.size(); ++i) {
+        if (wallTiles[i] >= 0) cells[i] = WALL;
+    }
+
+    if (doorRow >= 0 && doorRow < rows && doorCol >= 0 && doorCol < cols) {
+        cells[static_cast<std::size_t>(doorRow) * cols + doorCol] = DOOR;
+    }
+}
+
+int TileLattice::floorDiv(std::int32_t value) {
+    // Afronden naar -oneindig (ook voor negatieve posities tijdens wraparound)
+    return value >= 0 ? value / SUBTILES : -((-value + SUBTILES - 1) / SUBTILES);
+}
+
+int TileLattice::stepX(Direction dir) {
+    return dir == Direction::LEFT ? -1 : (dir == Direction::RIGHT ? 1 : 0);
+}
+
+int TileLattice::stepY(Direction dir) {
+    return dir == Direction::UP ? -1 : (dir == Direction::DOWN ? 1 : 0);
+}
+
+bool TileLattice::isOpen(int row, int col, bool doorBlocks) const {
+    if (row < 0 || row >= rows || cols == 0) return false;
+
+    // Tunnel: kolommen wrappen
+    col = ((col % cols) + cols) % cols;
+
+    std::uint8_t cell = cells[static_cast<std::size_t>(row) * cols + col];
+    if (cell == WALL) return false;
+    if (cell == DOOR) return !doorBlocks;
+    return true;
+}
+
+bool TileLattice::canEnter(const LatticePosition& pos, Direction dir, bool doorBlocks) const {
+    if (dir == Direction::NONE) return false;
+    return isOpen(rowOf(pos) + stepY(dir), colOf(pos) + stepX(dir), doorBlocks);
+}
+
+int TileLattice::countExits(const LatticePosition& pos, bool doorBlocks) const {
+    int exits = 0;
+    for (Direction dir : {Direction::UP, Direction::DOWN, Direction::LEFT, Direction::RIGHT}) {
+        if (canEnter(pos, dir, doorBlocks)) exits++;
+    }
+    return exits;
+}
+
+bool TileLattice::isAtCenter(const LatticePosition& pos) const {
+    return pos.x - colOf(pos) * SUBTILES == CENTER && pos.y - rowOf(pos) * SUBTILES == CENTER;
+}
+
+LatticePosition TileLattice::toLattice(const Position& worldPos) const {
+    LatticePosition result;
+    result.x = static_cast<std::int32_t>(std::lround((worldPos.x + worldWidth) / tileSize * SUBTILES));
+    result.y = static_cast<std::int32_t>(std::lround((worldPos.y + 1.0f) / tileSize * SUBTILES));
+    return result;
+}
+
+LatticePosition TileLattice::snap(const Position& worldPos) const {
+    LatticePosition exact = toLattice(worldPos);
+
+    LatticePosition result;
+    result.x = std::clamp(colOf(exact), 0, cols - 1) * SUBTILES + CENTER;
+    result.y = std::clamp(rowOf(exact), 0, rows - 1) * SUBTILES + CENTER;
+    return result;
+}
+
+Position TileLattice::toWorld(const LatticePosition& pos) const {
+    return Position(-worldWidth + static_cast<float>(pos.x) / SUBTILES * tileSize,
+                    -1.0f + static_cast<float>(pos.y) / SUBTILES * tileSize);
+}
+
+std::int64_t TileLattice::subtilesPerSecond(float speed) const {
+    return std::llround(speed / tileSize * SUBTILES);
+}
+
+std::int64_t TileLattice::toMicros(float deltaTime) {
+    return std::llround(static_cast<double>(deltaTime) * MICROS_PER_SECOND);
+}
+
+std::int32_t TileLattice::stepFor(std::int64_t subtilesPerSecond, std::int64_t micros, std::int64_t& carry) {
+    std::int64_t total = subtilesPerSecond * micros + carry;
+    carry = total % MICROS_PER_SECOND;
+    return static_cast<std::int32_t>(total / MICROS_PER_SECOND);
+}
+
+void TileLattice::wrap(LatticePosition& pos) const {
+    const std::int32_t width = cols * SUBTILES;
+    if (pos.x < 0) {
+        pos.x += width;
+    } else if (pos.x >= width) {
+        pos.x -= width;
+    }
+}
+
+} // namespace pacman
@@ -0,0 +1,137 @@
+#include "logic/VisibilityIndex.h"
+#include <algorithm>
+#include <cmath>
+
+namespace pacman {
+
+void VisibilityIndex::setGrid(float originX, float originY, float tileSize, int cols, int rows) {
+    this->originX = originX;
+    this->originY = originY;
+    inverseTileSize = 1.0f / tileSize;
+    this->cols = std::max(cols, 1);
+    this->rows = std::max(rows, 1);
+    clear();
+}
+
+void VisibilityIndex::clear() {
+    staged.clear();
+    bounds.clear();
+    inserted.clear();
+    entries.clear();
+    tileStart.clear();
+    seenStamp.clear();
+    currentStamp = 0;
+}
+
+int VisibilityIndex::tileColumn(float x) const {
+    auto column = static_cast<int>(std::floor((x - originX) * inverseTileSize));
+    return std::clamp(column, 0, cols - 1);
+}
+
+int VisibilityIndex::tileRow(float y) const {
+    auto row = static_cast<int>(std::floor((y - originY) * inverseTileSize));
+    return std::clamp(row, 0, rows - 1);
+}
+
+int VisibilityIndex::lastTileColumn(float right) const {
+    auto column = static_cast<int>(std::ceil((right - originX) * inverseTileSize)) - 1;
+    return std::clamp(column, 0, cols - 1);
+}
+
+int VisibilityIndex::lastTileRow(float bottom) const {
+    auto row = static_cast<int>(std::ceil((bottom - originY) * inverseTileSize)) - 1;
+    return std::clamp(row, 0, rows - 1);
+}
+
+void VisibilityIndex::insert(std::uint32_t id, const BoundingBox& box) {
+    staged.push_back({id, box});
+}
+
+void VisibilityIndex::build() {
+    std::uint32_t maxId = 0;
+    for (const Staged& entry : staged) {
+        maxId = std::max(maxId, entry.id + 1);
+    }
+    bounds.assign(maxId, BoundingBox(0.0f, 0.0f, 0.0f, 0.0f));
+    inserted.assign(maxId, 0);
+    seenStamp.assign(maxId, 0);
+    currentStamp = 0;
+
+    // Rechter/onderrand exclusief: een box van precies één tile komt in één bucket
+    // (query() gebruikt inclusieve randen, elke overlap blijft gevonden)
+    auto forEachTile = [this](const BoundingBox& box, auto&& visit) {
+        int firstColumn = tileColumn(box.left);
+        int lastColumn = std::max(firstColumn, lastTileColumn(box.right()));
+        int firstRow = tileRow(box.top);
+        int lastRow = std::max(firstRow, lastTileRow(box.bottom()));
+        for (int row = firstRow; row <= lastRow; ++row) {
+            for (int column = firstColumn; column <= lastColumn; ++column) {
+                visit(static_cast<std::size_t>(row) * cols + column);
+            }
+        }
+    };
+
+    // Counting sort: tel per tile, prefix sum, verdeel
+    std::size_t tileCount = getTileCount();
+    tileStart.assign(tileCount + 1, 0);
+    for (const Staged& entry : staged) {
+        bounds[entry.id] = entry.bounds;
+        inserted[entry.id] = 1;
+        forEachTile(entry.bounds, [this](std::size_t tile) { tileStart[tile + 1]++; });
+    }
+    for (std::size_t t = 0; t < tileCount; ++t) {
+        tileStart[t + 1] += tileStart[t];
+    }
+
+    entries.resize(tileStart[tileCount]);
+    std::vector<std::uint32_t> cursor(tileStart.begin(), tileStart.end() - 1);
+    for (const Staged& entry : staged) {
+        forEachTile(entry.bounds, [&](std::size_t tile) { entries[cursor[tile]++] = entry.id; });
+    }
+
+    staged.clear();
+}
+
+void VisibilityIndex::query(const BoundingBox& area, std::vector<std::uint32_t>& ids) const {
+    ids.clear();
+    if (entries.empty()) return;
+
+    int firstColumn = tileColumn(area.left);
+    int lastColumn = tileColumn(area.right());
+    int firstRow = tileRow(area.top);
+    int lastRow = tileRow(area.bottom());
+
+    // Grote area (meer tiles dan entries, bv. hele map zichtbaar): lineair is goedkoper
+    auto tileCount = static_cast<std::size_t>(lastColumn - firstColumn + 1) * static_cast<std::size_t>(lastRow - firstRow + 1);
+    if (tileCount >= bounds.size()) {
+        for (std::uint32_t id = 0; id < bounds.size(); ++id) {
+            if (inserted[id] && bounds[id].intersects(area)) {
+                ids.push_back(id);
+            }
+        }
+        return;
+    }
+
+    // Stamp overflow: één keer per 2^32 queries alles resetten
+    if (++currentStamp == 0) {
+        std::fill(seenStamp.begin(), seenStamp.end(), 0);
+        currentStamp = 1;
+    }
+
+    for (int row = firstRow; row <= lastRow; ++row) {
+        std::size_t rowStart = static_cast<std::size_t>(row) * cols;
+        for (std::size_t tile = rowStart + firstColumn; tile <= rowStart + lastColumn; ++tile) {
+            for (std::uint32_t i = tileStart[tile]; i < tileStart[tile + 1]; ++i) {
+                std::uint32_t id = entries[i];
+                if (seenStamp[id] == currentStamp) continue;
+                seenStamp[id] = currentStamp;
+
+                if (bounds[id].intersects(area)) {
+                    ids.push_back(id);
+                }
+            }
+        }
+    }
+}
+
+} // namespace pacman
@@ -1,5 +1,7 @@
 #include "logic/World.h"
+#include "logic/RenderSnapshot.h"
 
+#include "logic/utils/Profiler.h"
 #include "logic/utils/Random.h"
 #include "logic/utils/Stopwatch.h"
 #include "logic/entities/Ghost.h"
@@ -7,18 +9,24 @@
 #include <sstream>
 #include <iostream>
 #include <cmath>
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
 
 namespace pacman {
 
 World::World(AbstractFactory& factory, std::shared_ptr<Camera> camera,
              int startLevel, int initialScore)
-    : factory(factory), camera(camera), currentLevel(startLevel) {
+    : factory(factory), camera(camera), entityRegistry(factory.getRegistry()), ghostSystem(*this),
+      currentLevel(startLevel) {
     if (initialScore > 0) {
         score.addPoints(initialScore);  // of score = Score(initialScore) als je constructor hebt
     }
 }
 
 void World::update(float deltaTime) {
+    PACMAN_PROFILE_SCOPE("World::update");
+
     if (deathAnimationPlaying) {
         deathAnimationTimer += deltaTime;
 
@@ -41,15 +49,16 @@ void World::update(float deltaTime) {
     score.updateComboTimer(deltaTime);
 
     if (pacman) {
-        updatePacManWithCollisions(deltaTime);
-        checkWraparound(pacman.get());
+        if (movementMode == MovementMode::TILE_LATTICE) {
+            updatePacManOnLattice(deltaTime);  // Wraparound zit in het rooster
+        } else {
+            updatePacManWithCollisions(deltaTime);
+            checkWraparound(pacman.get());
+        }
         pacman->update(deltaTime);
     }
 
-    for (auto& ghost : ghosts) {
-        ghost->update(deltaTime);
-        checkWraparound(ghost.get());
-    }
+    ghostSystem.update(deltaTime);
 
     for (auto& coin : coins) {
         coin->update(deltaTime);
@@ -63,6 +72,7 @@ void World::update(float deltaTime) {
         wall->update(deltaTime);
     }
 
+    rebuildDynamicEntities();
     handleCollisions();
 
     if (isLevelComplete()) {
@@ -93,6 +103,212 @@ void World::checkWraparound(EntityModel* entity) {
     }
 }
 
+World::TileRange World::tilesUnder(const BoundingBox& box) const {
+    float worldWidth = static_cast<float>(mapCols) / static_cast<float>(mapRows);
+    float tileSize = 2.0f / static_cast<float>(mapRows);
+
+    // Tiles onder de box, 1 tile marge tegen afrondingsfouten
+    int firstCol = static_cast<int>(std::floor((box.left + worldWidth) / tileSize)) - 1;
+    int lastCol = static_cast<int>(std::floor((box.right() + worldWidth) / tileSize)) + 1;
+    int firstRow = static_cast<int>(std::floor((box.top + 1.0f) / tileSize)) - 1;
+    int lastRow = static_cast<int>(std::floor((box.bottom() + 1.0f) / tileSize)) + 1;
+
+    return {std::max(firstRow, 0), std::min(lastRow, mapRows - 1),
+            std::max(firstCol, 0), std::min(lastCol, mapCols - 1)};
+}
+
+bool World::intersectsWall(const BoundingBox& box) const {
+    if (wallTiles.empty()) return false;
+
+    auto [firstRow, lastRow, firstCol, lastCol] = tilesUnder(box);
+
+    const float boxRight = box.right();
+    const float boxBottom = box.bottom();
+
+    for (int row = firstRow; row <= lastRow; ++row) {
+        int lastTested = -1;  // Naburige tiles in een rij delen meestal dezelfde rechthoek
+
+        for (int col = firstCol; col <= lastCol; ++col) {
+            int rectIndex = wallTiles[row * mapCols + col];
+            if (rectIndex < 0 || rectIndex == lastTested) continue;
+            lastTested = rectIndex;
+
+            // Zelfde predicaat als BoundingBox::intersects
+            const WallRect& rect = wallRects[rectIndex];
+            if (!(boxRight < rect.left || box.left > rect.right ||
+                  boxBottom < rect.top || box.top > rect.bottom)) {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+float World::sweepWalls(const Position& pos, float radius, Direction dir, float distance,
+                        const Ghost* ghost) const {
+    if (dir == Direction::NONE || distance <= 0.0f) return distance;
+
+    const bool horizontal = (dir == Direction::LEFT || dir == Direction::RIGHT);
+    const bool positive = (dir == Direction::RIGHT || dir == Direction::DOWN);
+    const float tileSize = 2.0f / static_cast<float>(mapRows);
+    const float SWEEP_SKIN = tileSize * 0.001f;  // Eindpositie raakt de wall net niet
+
+    const BoundingBox box(pos.x - radius, pos.y - radius, radius * 2.0f, radius * 2.0f);
+    const float boxRight = box.right();
+    const float boxBottom = box.bottom();
+
+    // Afstand tot het eerste contact langs de as (< 0: start botst al)
+    float contact = std::numeric_limits<float>::max();
+
+    auto addObstacle = [&](float left, float top, float right, float bottom) {
+        // Enkel obstakels die de box loodrecht op de beweging overlappen
+        bool overlaps = horizontal ? !(boxBottom < top || box.top > bottom)
+                                   : !(boxRight < left || box.left > right);
+        if (!overlaps) return;
+
+        float boxNear = horizontal ? (positive ? boxRight : box.left) : (positive ? boxBottom : box.top);
+        float boxFar = horizontal ? (positive ? box.left : boxRight) : (positive ? box.top : boxBottom);
+        float near = horizontal ? (positive ? left : right) : (positive ? top : bottom);
+        float far = horizontal ? (positive ? right : left) : (positive ? bottom : top);
+
+        // Obstakel volledig achter de box
+        if (positive ? far < boxFar : far > boxFar) return;
+
+        float gap = positive ? near - boxNear : boxNear - near;
+        contact = std::min(contact, gap);
+    };
+
+    if (!wallTiles.empty()) {
+        // Swept box: start box uitgerekt over de hele afstand
+        BoundingBox swept = box;
+        if (horizontal) {
+            swept.width += distance;
+            if (!positive) swept.left -= distance;
+        } else {
+            swept.height += distance;
+            if (!positive) swept.top -= distance;
+        }
+
+        auto [firstRow, lastRow, firstCol, lastCol] = tilesUnder(swept);
+
+        for (int row = firstRow; row <= lastRow; ++row) {
+            int lastTested = -1;
+            for (int col = firstCol; col <= lastCol; ++col) {
+                int rectIndex = wallTiles[row * mapCols + col];
+                if (rectIndex < 0 || rectIndex == lastTested) continue;
+                lastTested = rectIndex;
+
+                const WallRect& rect = wallRects[rectIndex];
+                addObstacle(rect.left, rect.top, rect.right, rect.bottom);
+            }
+        }
+    }
+
+    // Door blokkeert het center (zoals wouldCollideWithWall), als punt tegen de door tile
+    if (hasDoor && ghost && ghost->hasPassedThroughDoor()) {
+        float worldWidth = static_cast<float>(mapCols) / static_cast<float>(mapRows);
+        auto grid = worldToGrid(pos);
+        float doorLeft = -worldWidth + doorGridPos.col * tileSize;
+        float doorTop = -1.0f + doorGridPos.row * tileSize;
+
+        if (horizontal ? grid.row == doorGridPos.row : grid.col == doorGridPos.col) {
+            float center = horizontal ? pos.x : pos.y;
+            float doorNear = horizontal ? doorLeft : doorTop;
+            float doorFar = doorNear + tileSize;
+
+            if (center >= doorNear && center < doorFar) {
+                contact = std::min(contact, -1.0f);
+            } else if (positive ? center < doorNear : center >= doorFar) {
+                float gap = positive ? doorNear - center : center - doorFar;
+                contact = std::min(contact, gap);
+            }
+        }
+    }
+
+    // Raakt het pad niets, dan de volle afstand (identiek aan de vroegere eindpositie test)
+    if (contact > distance) return distance;
+    return std::max(0.0f, contact - SWEEP_SKIN);
+}
+
+void World::buildWallTiles() {
+    const std::size_t tileCount = static_cast<std::size_t>(mapRows) * mapCols;
+
+    // Wall index per tile
+    const auto& wallTransforms = components.wallTransforms;
+    const Collider wallCollider{components.wallRadius};
+
+    std::vector<int> tileWalls(tileCount, -1);
+    for (std::size_t i = 0; i < wallTransforms.size(); ++i) {
+        auto grid = worldToGrid(wallTransforms[i].position);
+        if (grid.row < 0 || grid.row >= mapRows || grid.col < 0 || grid.col >= mapCols) continue;
+        tileWalls[grid.row * mapCols + grid.col] = static_cast<int>(i);
+    }
+
+    wallRects.clear();
+    wallTiles.assign(tileCount, -1);
+
+    auto isFree = [&](int row, int col) {
+        std::size_t tile = static_cast<std::size_t>(row) * mapCols + col;
+        return tileWalls[tile] >= 0 && wallTiles[tile] < 0;
+    };
+
+    // Greedy: vanaf elke vrije wall tile (row-major) de grootste van
+    // "eerst breedte, dan hoogte" en "eerst hoogte, dan breedte"
+    for (int row = 0; row < mapRows; ++row) {
+        for (int col = 0; col < mapCols; ++col) {
+            if (!isFree(row, col)) continue;
+
+            int runWidth = 1;
+            while (col + runWidth < mapCols && isFree(row, col + runWidth)) runWidth++;
+            int runWidthHeight = 1;
+            while (row + runWidthHeight < mapRows) {
+                bool fullRow = true;
+                for (int c = col; c < col + runWidth && fullRow; ++c) fullRow = isFree(row + runWidthHeight, c);
+                if (!fullRow) break;
+                runWidthHeight++;
+            }
+
+            int runHeight = 1;
+            while (row + runHeight < mapRows && isFree(row + runHeight, col)) runHeight++;
+            int runHeightWidth = 1;
+            while (col + runHeightWidth < mapCols) {
+                bool fullColumn = true;
+                for (int r = row; r < row + runHeight && fullColumn; ++r) fullColumn = isFree(r, col + runHeightWidth);
+                if (!fullColumn) break;
+                runHeightWidth++;
+            }
+
+            int rectRows = runWidthHeight;
+            int rectCols = runWidth;
+            if (runHeight * runHeightWidth > runWidth * runWidthHeight) {
+                rectRows = runHeight;
+                rectCols = runHeightWidth;
+            }
+
+            // Unie van de tile boxes (exacte floats van de walls)
+            WallRect rect{std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+                          std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(),
+                          row, col, rectRows, rectCols};
+            int rectIndex = static_cast<int>(wallRects.size());
+
+            for (int r = row; r < row + rectRows; ++r) {
+                for (int c = col; c < col + rectCols; ++c) {
+                    std::size_t tile = static_cast<std::size_t>(r) * mapCols + c;
+                    BoundingBox wallBox = wallCollider.boxAt(wallTransforms[tileWalls[tile]].position);
+                    rect.left = std::min(rect.left, wallBox.left);
+                    rect.top = std::min(rect.top, wallBox.top);
+                    rect.right = std::max(rect.right, wallBox.right());
+                    rect.bottom = std::max(rect.bottom, wallBox.bottom());
+                    wallTiles[tile] = rectIndex;
+                }
+            }
+
+            wallRects.push_back(rect);
+        }
+    }
+}
+
 bool World::wouldCollideWithWall(const Position& pos, float radius, const Ghost* ghost) const {
     BoundingBox testBox(
         pos.x - radius,
@@ -101,10 +317,8 @@ bool World::wouldCollideWithWall(const Position& pos, float radius, const Ghost*
         radius * 2.0f
     );
 
-    for (const auto& wall : walls) {
-        if (testBox.intersects(wall->getBoundingBox())) {
-            return true;
-        }
+    if (intersectsWall(testBox)) {
+        return true;
     }
 
     if (hasDoor) {
@@ -133,10 +347,8 @@ bool World::canMoveInDirection(const Position& pos, Direction dir, float radius,
         radius * 2.0f
     );
 
-    for (const auto& wall : walls) {
-        if (testBox.intersects(wall->getBoundingBox())) {
-            return false;
-        }
+    if (intersectsWall(testBox)) {
+        return false;
     }
 
     if (hasDoor) {
@@ -198,209 +410,348 @@ void World::updatePacManWithCollisions(float deltaTime) {
     Position dirVector = getDirectionVector(currentDir);
     float speed = pacman->getSpeed();
     Position movement = dirVector * speed * deltaTime;
+    float distance = speed * deltaTime;
+    float radius = pacman->getCollisionRadius();
 
     Position currentPos = pacman->getPosition();
-    Position testPos = currentPos + movement;
 
-    BoundingBox testBox(
-        testPos.x - pacman->getCollisionRadius(),
-        testPos.y - pacman->getCollisionRadius(),
-        pacman->getCollisionRadius() * 2.0f,
-        pacman->getCollisionRadius() * 2.0f
-    );
+    // Swept: het hele pad moet vrij zijn, niet enkel de eindpositie
+    float travel = sweepWalls(currentPos, radius, currentDir, distance);
 
-    bool collision = false;
-    for (const auto& wall : walls) {
-        if (testBox.intersects(wall->getBoundingBox())) {
-            collision = true;
-            break;
-        }
+    if (travel >= distance) {
+        pacman->setPosition(currentPos + movement);
+        return;
     }
 
     float tileSize = 2.0f / mapRows;
     const float CORNER_SMOOTH = tileSize * 0.08f;
 
-    if (!collision) {
-        pacman->setPosition(testPos);
-        return;
-    }
+    // Blocked - try corner smoothing in BOTH perpendicular directions
+    if (distance > 0.001f) {
+        Position perpendicular = (currentDir == Direction::LEFT || currentDir == Direction::RIGHT)
+            ? Position(0.0f, 1.0f)    // UP, DOWN
+            : Position(1.0f, 0.0f);   // LEFT, RIGHT
 
-    // Collision detected - try axis-only movement
-    if (currentDir == Direction::LEFT || currentDir == Direction::RIGHT) {
-        // Try X-only movement
-        Position xOnlyPos = Position(currentPos.x + movement.x, currentPos.y);
-        BoundingBox xBox(
-            xOnlyPos.x - pacman->getCollisionRadius(),
-            xOnlyPos.y - pacman->getCollisionRadius(),
-            pacman->getCollisionRadius() * 2.0f,
-            pacman->getCollisionRadius() * 2.0f
-        );
+        for (float offset : {-CORNER_SMOOTH, CORNER_SMOOTH}) {
+            Position nudged = currentPos + perpendicular * offset;
+            BoundingBox nudgedBox(nudged.x - radius, nudged.y - radius, radius * 2.0f, radius * 2.0f);
 
-        bool xCollision = false;
-        for (const auto& wall : walls) {
-            if (xBox.intersects(wall->getBoundingBox())) {
-                xCollision = true;
-                break;
+            if (!intersectsWall(nudgedBox) && sweepWalls(nudged, radius, currentDir, distance) >= distance) {
+                pacman->setPosition(nudged + movement);
+                return;
             }
         }
+    }
+
+    // No smoothing possible - move up to the wall
+    pacman->setPosition(currentPos + dirVector * travel);
+}
 
-        if (!xCollision) {
-            pacman->setPosition(xOnlyPos);
-            return;
+bool World::isPositionBlocked(const Position& pos, float radius) const {
+    for (const Transform& wall : components.wallTransforms) {
+        float distance = pos.distance(wall.position);
+        if (distance < radius + components.wallRadius) {
+            return true;
         }
+    }
+    return false;
+}
 
-        // X blocked - try corner smoothing in BOTH perpendicular directions
-        if (std::abs(movement.x) > 0.001f) {
-            std::vector<Position> candidates = {
-                Position(currentPos.x + movement.x, currentPos.y - CORNER_SMOOTH),  // UP
-                Position(currentPos.x + movement.x, currentPos.y + CORNER_SMOOTH)   // DOWN
-            };
-
-            for (const Position& candidate : candidates) {
-                BoundingBox testBox(
-                    candidate.x - pacman->getCollisionRadius(),
-                    candidate.y - pacman->getCollisionRadius(),
-                    pacman->getCollisionRadius() * 2.0f,
-                    pacman->getCollisionRadius() * 2.0f
-                );
-
-                bool canMove = true;
-                for (const auto& wall : walls) {
-                    if (testBox.intersects(wall->getBoundingBox())) {
-                        canMove = false;
-                        break;
-                    }
-                }
+bool World::checkWallCollision(const Position& pos, float radius) const {
+    for (const Transform& wall : components.wallTransforms) {
+        float distance = pos.distance(wall.position);
+        float minDistance = radius + components.wallRadius;
 
-                if (canMove) {
-                    pacman->setPosition(candidate);
-                    return;
-                }
-            }
+        if (distance < minDistance) {
+            return true;
         }
     }
-    else {  // UP or DOWN
-        // Try Y-only movement
-        Position yOnlyPos = Position(currentPos.x, currentPos.y + movement.y);
-        BoundingBox yBox(
-            yOnlyPos.x - pacman->getCollisionRadius(),
-            yOnlyPos.y - pacman->getCollisionRadius(),
-            pacman->getCollisionRadius() * 2.0f,
-            pacman->getCollisionRadius() * 2.0f
-        );
+    return false;
+}
 
-        bool yCollision = false;
-        for (const auto& wall : walls) {
-            if (yBox.intersects(wall->getBoundingBox())) {
-                yCollision = true;
-                break;
+void World::updatePacManOnLattice(float deltaTime) {
+    if (tileLattice.empty()) return;
+
+    // Extern verplaatst (spawn, reset na death): snap naar tile center
+    Position expected = tileLattice.toWorld(pacmanLattice);
+    Position current = pacman->getPosition();
+    if (expected.x != current.x || expected.y != current.y) {
+        pacmanLattice = tileLattice.snap(current);
+        pacmanLatticeCarry = 0;
+    }
+
+    Direction currentDir = pacman->getDirection();
+    Direction nextDir = pacman->getNextDirection();
+
+    bool isOpposite = (
+        (currentDir == Direction::UP && nextDir == Direction::DOWN) ||
+        (currentDir == Direction::DOWN && nextDir == Direction::UP) ||
+        (currentDir == Direction::LEFT && nextDir == Direction::RIGHT) ||
+        (currentDir == Direction::RIGHT && nextDir == Direction::LEFT)
+    );
+
+    // Omkeren mag overal: de tile achter PacMan is altijd open
+    if (isOpposite) {
+        pacman->tryChangeDirection(nextDir);
+        currentDir = nextDir;
+    }
+
+    std::int32_t distance = TileLattice::stepFor(tileLattice.subtilesPerSecond(pacman->getSpeed()),
+                                                 TileLattice::toMicros(deltaTime), pacmanLatticeCarry);
+
+    tileLattice.advance(pacmanLattice, currentDir, distance, true,
+                        [this](const LatticePosition& at, Direction dir) {
+                            Direction wanted = pacman->getNextDirection();
+                            if (wanted != Direction::NONE && wanted != dir && tileLattice.canEnter(at, wanted, true)) {
+                                pacman->tryChangeDirection(wanted);
+                                return wanted;
+                            }
+                            return dir;
+                        });
+
+    pacman->setPosition(tileLattice.toWorld(pacmanLattice));
+}
+
+void World::handleCollisions() {
+    PACMAN_PROFILE_SCOPE("World::handleCollisions");
+
+    if (!pacman) return;
+
+    const BoundingBox pacmanBox = pacman->getBoundingBox();
+
+    // Pickup: component state eerst, daarna scoring via het Model (OBJECTS) of direct
+    collisionHits.clear();
+    coinBoxes.query(pacmanBox, collisionHits);
+    for (std::uint32_t index : collisionHits) {
+        if (components.coins.collect(index)) {
+            if (entityStorage == EntityStorage::OBJECTS) {
+                coins[index]->collect();
+            } else {
+                notifyCollected(EventType::COIN_COLLECTED, components.coins.states[index]);
             }
         }
+        coinBoxes.disable(index);
+    }
 
-        if (!yCollision) {
-            pacman->setPosition(yOnlyPos);
-            return;
+    collisionHits.clear();
+    fruitBoxes.query(pacmanBox, collisionHits);
+    for (std::uint32_t index : collisionHits) {
+        if (components.fruits.collect(index)) {
+            if (entityStorage == EntityStorage::OBJECTS) {
+                fruits[index]->collect();
+            } else {
+                notifyCollected(EventType::FRUIT_COLLECTED, components.fruits.states[index]);
+            }
         }
+        fruitBoxes.disable(index);
+        activateFearMode();
+    }
 
-        // Y blocked - try corner smoothing in BOTH perpendicular directions
-        if (std::abs(movement.y) > 0.001f) {
-            std::vector<Position> candidates = {
-                Position(currentPos.x - CORNER_SMOOTH, currentPos.y + movement.y),  // LEFT
-                Position(currentPos.x + CORNER_SMOOTH, currentPos.y + movement.y)   // RIGHT
-            };
-
-            for (const Position& candidate : candidates) {
-                BoundingBox testBox(
-                    candidate.x - pacman->getCollisionRadius(),
-                    candidate.y - pacman->getCollisionRadius(),
-                    pacman->getCollisionRadius() * 2.0f,
-                    pacman->getCollisionRadius() * 2.0f
-                );
-
-                bool canMove = true;
-                for (const auto& wall : walls) {
-                    if (testBox.intersects(wall->getBoundingBox())) {
-                        canMove = false;
-                        break;
-                    }
-                }
-
-                if (canMove) {
-                    pacman->setPosition(candidate);
-                    return;
-                }
+    // Ghosts rond PacMan (spatial hash of lineair, IN_SPAWN ghosts tellen niet mee)
+    queryDynamicEntities(pacmanBox, collisionHits);
+    collisionHits.erase(std::remove_if(collisionHits.begin(), collisionHits.end(),
+                                       [this](std::uint32_t id) {
+                                           return id == PACMAN_ENTITY_ID ||
+                                                  ghosts[id]->getState() == GhostState::IN_SPAWN;
+                                       }),
+                        collisionHits.end());
+
+    for (std::uint32_t index : collisionHits) {
+        auto& ghost = ghosts[index];
+
+        if (ghost->isScared()) {
+            ghost->die();
+        } else {
+            pacman->loseLife();
+
+            if (pacman->isAlive()) {
+                deathAnimationPlaying = true;
+                deathAnimationTimer = 0.0f;
             }
+
+            break;
         }
     }
-    // No movement possible - stay at current position
 }
 
-bool World::isPositionBlocked(const Position& pos, float radius) const {
-    for (const auto& wall : walls) {
-        float distance = pos.distance(wall->getPosition());
-        if (distance < radius + wall->getCollisionRadius()) {
-            return true;
+void World::buildCollectibleBoxes() {
+    auto fill = [](AabbBatch& boxes, const CollectibleArrays& arrays) {
+        boxes.clear();
+        boxes.reserve(arrays.size());
+        for (std::size_t i = 0; i < arrays.size(); ++i) {
+            std::size_t index = boxes.add(arrays.colliders[i].boxAt(arrays.transforms[i].position));
+            if (arrays.states[i].collected) boxes.disable(index);
         }
+    };
+
+    fill(coinBoxes, components.coins);
+    fill(fruitBoxes, components.fruits);
+}
+
+void World::notifyCollected(EventType type, const Collectible& collectible) {
+    Event event;
+    event.type = type;
+    event.value = collectible.points;
+    score.onNotify(event);
+}
+
+void World::requireOwnerThread(const char* caller) const {
+    if (std::this_thread::get_id() != ownerThread.load(std::memory_order_acquire)) {
+        throw std::logic_error(std::string(caller) + ": COMPONENTS adapters only on the World's owner thread");
     }
-    return false;
 }
 
-bool World::checkWallCollision(const Position& pos, float radius) const {
-    for (const auto& wall : walls) {
-        float distance = pos.distance(wall->getPosition());
-        float minDistance = radius + wall->getCollisionRadius();
+const std::vector<EntityPtr<Coin>>& World::getCoins() const {
+    if (entityStorage == EntityStorage::OBJECTS) return coins;
+    requireOwnerThread("World::getCoins");
 
-        if (distance < minDistance) {
-            return true;
+    const auto& arrays = components.coins;
+    if (coinAdapters.size() != arrays.size()) {
+        coinAdapters.clear();
+        for (const Transform& transform : arrays.transforms) {
+            coinAdapters.push_back(makeEntity<Coin>(nullptr, transform.position));
         }
     }
-    return false;
+    for (std::size_t i = 0; i < arrays.size(); ++i) {
+        coinAdapters[i]->setCollisionRadius(arrays.colliders[i].radius);
+        if (arrays.states[i].collected) coinAdapters[i]->collect();  // Geen observers: stil
+    }
+    return coinAdapters;
 }
 
-void World::handleCollisions() {
-    if (!pacman) return;
+const std::vector<EntityPtr<Fruit>>& World::getFruits() const {
+    if (entityStorage == EntityStorage::OBJECTS) return fruits;
+    requireOwnerThread("World::getFruits");
 
-    for (auto& coin : coins) {
-        if (!coin->isCollected() && pacman->intersects(*coin)) {
-            coin->collect();
+    const auto& arrays = components.fruits;
+    if (fruitAdapters.size() != arrays.size()) {
+        fruitAdapters.clear();
+        for (const Transform& transform : arrays.transforms) {
+            fruitAdapters.push_back(makeEntity<Fruit>(nullptr, transform.position));
         }
     }
+    for (std::size_t i = 0; i < arrays.size(); ++i) {
+        fruitAdapters[i]->setCollisionRadius(arrays.colliders[i].radius);
+        if (arrays.states[i].collected) fruitAdapters[i]->collect();
+    }
+    return fruitAdapters;
+}
 
-    for (auto& fruit : fruits) {
-        if (!fruit->isCollected() && pacman->intersects(*fruit)) {
-            fruit->collect();
-            activateFearMode();
+const std::vector<EntityPtr<Wall>>& World::getWalls() const {
+    if (entityStorage == EntityStorage::OBJECTS) return walls;
+    requireOwnerThread("World::getWalls");
+
+    if (wallAdapters.size() != components.wallTransforms.size()) {
+        wallAdapters.clear();
+        for (const Transform& transform : components.wallTransforms) {
+            wallAdapters.push_back(makeEntity<Wall>(nullptr, transform.position));
+            wallAdapters.back()->setCollisionRadius(components.wallRadius);
         }
     }
+    return wallAdapters;
+}
 
-    for (auto& ghost : ghosts) {
-        if (ghost->getState() == GhostState::IN_SPAWN) continue;
+void World::setSpatialHashMinGhosts(std::size_t count) {
+    spatialHashMinGhosts = count;
+    rebuildDynamicEntities();  // Hash meteen geldig als hij nu gebruikt wordt
+}
 
-        if (pacman->intersects(*ghost)) {
-            if (ghost->isScared()) {
-                ghost->die();
-            } else {
-                pacman->loseLife();
+void World::rebuildDynamicEntities() {
+    if (mapRows == 0 || !usesSpatialHash()) return;
 
-                if (pacman->isAlive()) {
-                    deathAnimationPlaying = true;
-                    deathAnimationTimer = 0.0f;
-                }
+    float worldWidth = static_cast<float>(mapCols) / static_cast<float>(mapRows);
+    float tileSize = 2.0f / static_cast<float>(mapRows);
 
-                break;
+    // Cellen = tiles (origin linkerbovenhoek van de map)
+    dynamicEntities.setGrid(-worldWidth, -1.0f, tileSize);
+    maxDynamicRadius = 0.0f;
+
+    for (std::size_t i = 0; i < ghosts.size(); ++i) {
+        dynamicEntities.insert(static_cast<std::uint32_t>(i), ghosts[i]->getPosition());
+        maxDynamicRadius = std::max(maxDynamicRadius, ghosts[i]->getCollisionRadius());
+    }
+    if (pacman) {
+        dynamicEntities.insert(PACMAN_ENTITY_ID, pacman->getPosition());
+        maxDynamicRadius = std::max(maxDynamicRadius, pacman->getCollisionRadius());
+    }
+
+    dynamicEntities.build();
+}
+
+void World::queryDynamicEntities(const BoundingBox& area, std::vector<std::uint32_t>& ids) const {
+    ids.clear();
+
+    if (!usesSpatialHash()) {
+        // Weinig ghosts: lineair, zelfde volgorde als de hash resultaten
+        for (std::size_t i = 0; i < ghosts.size(); ++i) {
+            if (area.intersects(ghosts[i]->getBoundingBox())) {
+                ids.push_back(static_cast<std::uint32_t>(i));
             }
         }
+        if (pacman && area.intersects(pacman->getBoundingBox())) {
+            ids.push_back(PACMAN_ENTITY_ID);
+        }
+        return;
+    }
+
+    // Hash bevat centers: een box raakt area enkel als zijn center binnen
+    // area + radius ligt (kleine extra marge tegen afronding)
+    float margin = maxDynamicRadius * 1.01f;
+    BoundingBox searchArea(area.left - margin, area.top - margin,
+                           area.width + 2.0f * margin, area.height + 2.0f * margin);
+
+    dynamicCandidates.clear();
+    dynamicEntities.query(searchArea, dynamicCandidates);
+
+    // Stijgende volgorde (PACMAN_ENTITY_ID = max → laatst), zoals een lineaire loop
+    std::sort(dynamicCandidates.begin(), dynamicCandidates.end());
+
+    for (std::uint32_t id : dynamicCandidates) {
+        const EntityModel* entity = (id == PACMAN_ENTITY_ID)
+            ? static_cast<const EntityModel*>(pacman.get())
+            : static_cast<const EntityModel*>(ghosts[id].get());
+        if (area.intersects(entity->getBoundingBox())) {
+            ids.push_back(id);
+        }
     }
 }
 
-bool World::isLevelComplete() const {
-    for (const auto& coin : coins) {
-        if (!coin->isCollected()) return false;
+void World::captureSnapshot(RenderSnapshot& out) const {
+    out.hasPacMan = pacman != nullptr;
+    if (pacman) {
+        out.pacmanPosition = pacman->getPosition();
+        out.pacmanDirection = pacman->getDirection();
+        out.lives = pacman->getLives();
     }
-    for (const auto& fruit : fruits) {
-        if (!fruit->isCollected()) return false;
+    out.deathAnimationPlaying = deathAnimationPlaying;
+
+    out.ghosts.resize(ghosts.size());
+    for (std::size_t i = 0; i < ghosts.size(); ++i) {
+        const Ghost& ghost = *ghosts[i];
+        auto& snapshot = out.ghosts[i];
+        snapshot.position = ghost.getPosition();
+        snapshot.direction = ghost.getCurrentDirection();
+        snapshot.state = ghost.getState();
+        snapshot.color = ghost.getColor();
+        snapshot.scaredTimeRemaining = ghost.getScaredTimeRemaining();
     }
-    return true;
+
+    auto copyCollected = [](const CollectibleArrays& arrays, std::vector<std::uint8_t>& flags) {
+        flags.resize(arrays.size());
+        for (std::size_t i = 0; i < arrays.size(); ++i) {
+            flags[i] = arrays.states[i].collected ? 1 : 0;
+        }
+    };
+    copyCollected(components.coins, out.coinsCollected);
+    copyCollected(components.fruits, out.fruitsCollected);
+
+    out.score = score.getCurrentScore();
+    out.levelComplete = isLevelComplete();
+    out.gameOver = isGameOver();
+}
+
+bool World::isLevelComplete() const {
+    return components.coins.remaining == 0 && components.fruits.remaining == 0;
 }
 
 bool World::isGameOver() const {
@@ -457,7 +808,21 @@ void World::loadLevel(const std::string& mapFile) {
     applyDifficultyScaling();
 }
 
+void World::loadLevelFromData(const std::vector<std::string>& mapData) {
+    if (mapData.empty()) {
+        throw std::runtime_error("Map data is empty");
+    }
+
+    spawnEntities(mapData);
+    this->attach(&score);
+    applyDifficultyScaling();
+}
+
 void World::parseMap(const std::string& mapFile) {
+    spawnEntities(readMapFile(mapFile));
+}
+
+std::vector<std::string> World::readMapFile(const std::string& mapFile) {
     std::ifstream file(mapFile);
     if (!file.is_open()) {
         throw std::runtime_error("Failed to open map file: " + mapFile);
@@ -476,7 +841,7 @@ void World::parseMap(const std::string& mapFile) {
         throw std::runtime_error("Map file is empty: " + mapFile);
     }
 
-    spawnEntities(mapData);
+    return mapData;
 }
 
 void World::spawnEntities(const std::vector<std::string>& mapData) {
@@ -500,20 +865,30 @@ void World::spawnEntities(const std::vector<std::string>& mapData) {
     coins.clear();
     fruits.clear();
     ghosts.clear();
+    components.clear();
+    coinAdapters.clear();
+    fruitAdapters.clear();
+    wallAdapters.clear();
+
+    const bool createModels = entityStorage == EntityStorage::OBJECTS;
 
     Position pacmanSpawnPos(0, 0);
     bool pacmanSpawned = false;
     int wallCount = 0;
     int coinCount = 0;
 
-    bool redSpawned = false;
-    bool pinkSpawned = false;
-    bool cyanSpawned = false;
-    bool orangeSpawned = false;
-    Position redPos(0, 0);
-    Position pinkPos(0, 0);
-    Position cyanPos(0, 0);
-    Position orangePos(0, 0);
+    // Ghost spawns uit de map (personality per tile, 'g' via roster)
+    struct GhostSpawn {
+        Position position;
+        GhostColor color;
+    };
+    std::vector<GhostSpawn> ghostSpawns;
+
+    static const std::vector<GhostColor> CLASSIC_ROSTER = {
+        GhostColor::RED, GhostColor::PINK, GhostColor::BLUE, GhostColor::ORANGE
+    };
+    const auto& roster = ghostRoster.personalities.empty() ? CLASSIC_ROSTER : ghostRoster.personalities;
+    std::size_t rosterIndex = 0;
 
     for (int row = 0; row < totalRows; ++row) {
         for (int col = 0; col < totalCols; ++col) {
@@ -525,14 +900,20 @@ void World::spawnEntities(const std::vector<std::string>& mapData) {
             switch (tile) {
             case 'x':
             case 'X':
-                walls.push_back(factory.createWall(worldPos));
+                components.wallTransforms.push_back({worldPos});
+                if (createModels) {
+                    walls.push_back(factory.createWall(worldPos));
+                }
                 wallCount++;
                 break;
 
             case ' ':
             case '.':
-                coins.push_back(factory.createCoin(worldPos));
-                coins.back()->attach(&score);
+                components.coins.add(worldPos, CollectibleKind::COIN, Coin::POINT_VALUE);
+                if (createModels) {
+                    coins.push_back(factory.createCoin(worldPos));
+                    coins.back()->attach(&score);
+                }
                 coinCount++;
                 break;
 
@@ -544,32 +925,36 @@ void World::spawnEntities(const std::vector<std::string>& mapData) {
 
             case 'c':
             case 'C':
-                fruits.push_back(factory.createFruit(worldPos));
-                fruits.back()->attach(&score);
+                components.fruits.add(worldPos, CollectibleKind::FRUIT, Fruit::POINT_VALUE);
+                if (createModels) {
+                    fruits.push_back(factory.createFruit(worldPos));
+                    fruits.back()->attach(&score);
+                }
                 break;
 
             case 'r':
             case 'R':
-                redPos = worldPos;
-                redSpawned = true;
+                ghostSpawns.push_back({worldPos, GhostColor::RED});
                 break;
 
             case 'i':
             case 'I':
-                pinkPos = worldPos;
-                pinkSpawned = true;
+                ghostSpawns.push_back({worldPos, GhostColor::PINK});
                 break;
 
             case 'b':
             case 'B':
-                cyanPos = worldPos;
-                cyanSpawned = true;
+                ghostSpawns.push_back({worldPos, GhostColor::BLUE});
                 break;
 
             case 'o':
             case 'O':
-                orangePos = worldPos;
-                orangeSpawned = true;
+                ghostSpawns.push_back({worldPos, GhostColor::ORANGE});
+                break;
+
+            case 'g':
+            case 'G':
+                ghostSpawns.push_back({worldPos, roster[rosterIndex++ % roster.size()]});
                 break;
 
             case 'd':
@@ -593,26 +978,22 @@ void World::spawnEntities(const std::vector<std::string>& mapData) {
         std::cerr << "WARNING: No PacMan ('p' or 'P') found in map - no PacMan spawned!" << std::endl;
     }
 
-    if (redSpawned) {
-        auto ghost = factory.createGhost(*this, redPos, GhostColor::RED);
-        ghost->attach(&score);
-        ghosts.push_back(std::move(ghost));
-    }
+    // Zelfde creatie volgorde als voorheen (RED, PINK, BLUE, ORANGE), stabiel binnen een kleur
+    std::stable_sort(ghostSpawns.begin(), ghostSpawns.end(),
+                     [](const GhostSpawn& a, const GhostSpawn& b) { return a.color < b.color; });
 
-    if (pinkSpawned) {
-        auto ghost = factory.createGhost(*this, pinkPos, GhostColor::PINK);
-        ghost->attach(&score);
-        ghosts.push_back(std::move(ghost));
-    }
+    ghosts.reserve(ghostSpawns.size());
+    int sameColorCount = 0;
 
-    if (cyanSpawned) {
-        auto ghost = factory.createGhost(*this, cyanPos, GhostColor::BLUE);
-        ghost->attach(&score);
-        ghosts.push_back(std::move(ghost));
-    }
+    for (std::size_t i = 0; i < ghostSpawns.size(); ++i) {
+        const auto& spawn = ghostSpawns[i];
+        sameColorCount = (i > 0 && ghostSpawns[i - 1].color == spawn.color) ? sameColorCount + 1 : 0;
 
-    if (orangeSpawned) {
-        auto ghost = factory.createGhost(*this, orangePos, GhostColor::ORANGE);
+        auto ghost = factory.createGhost(*this, spawn.position, spawn.color);
+        if (sameColorCount > 0) {
+            // Niet alle ghosts van een kleur tegelijk uit de spawn
+            ghost->setSpawnDelay(ghost->getSpawnDelay() + sameColorCount * ghostRoster.sameColorStagger);
+        }
         ghost->attach(&score);
         ghosts.push_back(std::move(ghost));
     }
@@ -638,6 +1019,16 @@ void World::spawnEntities(const std::vector<std::string>& mapData) {
     for (auto& fruit : fruits) {
         fruit->setCollisionRadius(tileSize * 0.30f);
     }
+
+    components.wallRadius = tileSize * 0.49f;
+    components.coins.setRadius(tileSize * 0.15f);
+    components.fruits.setRadius(tileSize * 0.30f);
+
+    buildWallTiles();
+    tileLattice.build(mapRows, mapCols, wallTiles, hasDoor ? doorGridPos.row : -1, hasDoor ? doorGridPos.col : -1);
+    pacmanLatticeCarry = 0;
+    buildCollectibleBoxes();
+    rebuildDynamicEntities();
 }
 
 bool World::isDoorPosition(const Position& pos) const {
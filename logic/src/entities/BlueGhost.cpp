@@ -8,12 +8,11 @@ BlueGhost::BlueGhost(World& world, const Position& pos)  // ✅ World& parameter
 }
 
 Direction BlueGhost::chooseDirection() {
-    // ❌ if (!world) return currentDirection; WEG
-    if (!isAtIntersection()) return currentDirection;
+    if (!isAtIntersection()) return getCurrentDirection();
 
     auto* pacman = world.getPacMan();  // world. niet world->
     if (!pacman) {
-        return currentDirection;
+        return getCurrentDirection();
     }
 
     Position pacmanPos = pacman->getPosition();
@@ -8,12 +8,11 @@ PinkGhost::PinkGhost(World& world, const Position& pos)  // ✅ World& parameter
 }
 
 Direction PinkGhost::chooseDirection() {
-    // ❌ if (!world) return currentDirection; WEG
-    if (!isAtIntersection()) return currentDirection;
+    if (!isAtIntersection()) return getCurrentDirection();
 
     auto* pacman = world.getPacMan();  // world. niet world->
     if (!pacman) {
-        return currentDirection;
+        return getCurrentDirection();
     }
 
     Position pacmanPos = pacman->getPosition();
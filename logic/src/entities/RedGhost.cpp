@@ -8,11 +8,11 @@ RedGhost::RedGhost(World& world, const Position& pos)
 }
 
 Direction RedGhost::chooseDirection() {
-    if (!isAtIntersection()) return currentDirection;
+    if (!isAtIntersection()) return getCurrentDirection();
 
     auto* pacman = world.getPacMan();  // world. niet world->
     if (!pacman) {
-        return currentDirection;
+        return getCurrentDirection();
     }
 
     Position pacmanPos = pacman->getPosition();
@@ -0,0 +1,185 @@
+#include "logic/utils/FrameStats.h"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <thread>
+
+namespace pacman {
+
+// ===== HdrHistogram =====
+
+HdrHistogram::HdrHistogram(int subBucketBits, int maxValueBits)
+    : subBucketBits(subBucketBits),
+      subBucketCount(std::uint64_t{1} << subBucketBits),
+      subBucketHalfCount(std::uint64_t{1} << (subBucketBits - 1)),
+      maxTrackableValue((std::uint64_t{1} << maxValueBits) - 1) {
+    counts.assign(bucketIndex(maxTrackableValue) + 1, 0);
+}
+
+std::size_t HdrHistogram::bucketIndex(std::uint64_t value) const {
+    if (value < subBucketCount) {
+        return static_cast<std::size_t>(value);
+    }
+
+    // magnitude >= 1: aantal bits onder de sub-bucket precisie
+    int magnitude = static_cast<int>(std::bit_width(value)) - subBucketBits;
+    std::uint64_t subBucket = value >> magnitude;  // In [half, count)
+    return static_cast<std::size_t>(magnitude * subBucketHalfCount + subBucket);
+}
+
+std::uint64_t HdrHistogram::highestEquivalentValue(std::size_t index) const {
+    if (index < subBucketCount) {
+        return index;
+    }
+
+    std::uint64_t magnitude = index / subBucketHalfCount - 1;
+    std::uint64_t subBucket = index - magnitude * subBucketHalfCount;
+    return ((subBucket + 1) << magnitude) - 1;
+}
+
+void HdrHistogram::record(std::uint64_t value) {
+    value = std::min(value, maxTrackableValue);
+
+    counts[bucketIndex(value)]++;
+
+    if (totalCount == 0 || value < minValue) minValue = value;
+    if (value > maxValue) maxValue = value;
+    totalCount++;
+    sum += value;
+}
+
+std::uint64_t HdrHistogram::valueAtPercentile(double percentile) const {
+    if (totalCount == 0) return 0;
+
+    percentile = std::clamp(percentile, 0.0, 100.0);
+    auto target = static_cast<std::uint64_t>(std::ceil(percentile / 100.0 * totalCount));
+    target = std::max<std::uint64_t>(target, 1);
+
+    std::uint64_t cumulative = 0;
+    for (std::size_t i = 0; i < counts.size(); ++i) {
+        cumulative += counts[i];
+        if (cumulative >= target) {
+            return std::min(highestEquivalentValue(i), maxValue);
+        }
+    }
+
+    return maxValue;
+}
+
+double HdrHistogram::getMean() const {
+    if (totalCount == 0) return 0.0;
+    return static_cast<double>(sum / totalCount);
+}
+
+void HdrHistogram::reset() {
+    std::fill(counts.begin(), counts.end(), 0);
+    totalCount = 0;
+    minValue = 0;
+    maxValue = 0;
+    sum = 0.0L;
+}
+
+// ===== FrameStats =====
+
+namespace {
+
+double toMs(std::uint64_t us) {
+    return static_cast<double>(us) / 1000.0;
+}
+
+void writeRow(std::ostream& out, const char* label, const HdrHistogram& histogram) {
+    out << std::left << std::setw(9) << label << std::right
+        << std::setw(9) << toMs(histogram.valueAtPercentile(50.0))
+        << std::setw(9) << toMs(histogram.valueAtPercentile(95.0))
+        << std::setw(9) << toMs(histogram.valueAtPercentile(99.0))
+        << std::setw(9) << toMs(histogram.getMax())
+        << std::setw(9) << histogram.getMean() / 1000.0 << "\n";
+}
+
+} // namespace
+
+void FrameStats::setTargetFrameTime(float seconds) {
+    targetFrameTime = seconds;
+}
+
+void FrameStats::record(const FrameSample& sample) {
+    updateHistogram.record(sample.updateUs);
+    renderHistogram.record(sample.renderUs);
+    presentHistogram.record(sample.presentUs);
+    frameHistogram.record(sample.frameUs);
+
+    const double targetUs = targetFrameTime * 1'000'000.0;
+    if (sample.frameUs > 4.0 * targetUs) {
+        severeHitchCount++;
+        hitchCount++;
+    } else if (sample.frameUs > 2.0 * targetUs) {
+        hitchCount++;
+    }
+
+    lastSample = sample;
+}
+
+void FrameStats::reset() {
+    updateHistogram.reset();
+    renderHistogram.reset();
+    presentHistogram.reset();
+    frameHistogram.reset();
+    hitchCount = 0;
+    severeHitchCount = 0;
+    lastSample = FrameSample();
+}
+
+std::string FrameStats::getOverlayText() const {
+    std::ostringstream oss;
+    oss << std::fixed << std::setprecision(2);
+
+    double frameMs = toMs(lastSample.frameUs);
+    oss << "FPS " << std::setprecision(0) << (frameMs > 0.0 ? 1000.0 / frameMs : 0.0)
+        << std::setprecision(2) << "\n";
+    oss << "ms        p50      p95      p99      max     mean\n";
+    writeRow(oss, "frame", frameHistogram);
+    writeRow(oss, "update", updateHistogram);
+    writeRow(oss, "render", renderHistogram);
+    writeRow(oss, "present", presentHistogram);
+    oss << "hitches " << hitchCount << "  severe " << severeHitchCount;
+
+    return oss.str();
+}
+
+bool FrameStats::writeSummary(const std::string& filename) const {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "FrameStats: could not open summary file: " << filename << std::endl;
+        return false;
+    }
+
+    file << std::fixed << std::setprecision(3);
+    file << "# PacMan frame statistics\n";
+#ifdef __VERSION__
+    file << "compiler: " << __VERSION__ << "\n";
+#endif
+#ifdef NDEBUG
+    file << "build: release\n";
+#else
+    file << "build: debug\n";
+#endif
+    file << "hardware_threads: " << std::thread::hardware_concurrency() << "\n";
+    file << "frames: " << getFrameCount() << "\n";
+    file << "target_frame_ms: " << targetFrameTime * 1000.0 << "\n";
+    file << "hitches (>2x target): " << hitchCount << "\n";
+    file << "severe_hitches (>4x target): " << severeHitchCount << "\n\n";
+
+    file << "ms        p50      p95      p99      max     mean\n";
+    writeRow(file, "frame", frameHistogram);
+    writeRow(file, "update", updateHistogram);
+    writeRow(file, "render", renderHistogram);
+    writeRow(file, "present", presentHistogram);
+
+    return true;
+}
+
+} // namespace pacman
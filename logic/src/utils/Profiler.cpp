@@ -0,0 +1,90 @@
+#include "logic/utils/Profiler.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+namespace pacman {
+
+Profiler::ThreadBuffer& Profiler::localBuffer() {
+    // Eén lookup per thread, daarna enkel een thread_local pointer
+    thread_local ThreadBuffer* buffer = nullptr;
+
+    if (!buffer) {
+        auto created = std::make_unique<ThreadBuffer>();
+        created->zones = std::make_unique<ProfileZone[]>(BUFFER_CAPACITY);
+
+        std::lock_guard<std::mutex> lock(registryMutex);
+        created->threadId = static_cast<std::uint32_t>(buffers.size() + 1);
+        buffer = created.get();
+        buffers.push_back(std::move(created));
+    }
+
+    return *buffer;
+}
+
+void Profiler::record(const char* name, std::int64_t startNs, std::int64_t endNs) {
+    ThreadBuffer& buffer = localBuffer();
+
+    // Single writer: relaxed load volstaat, release store publiceert de zone
+    std::size_t index = buffer.writeIndex.load(std::memory_order_relaxed);
+    ProfileZone& zone = buffer.zones[index % BUFFER_CAPACITY];
+    zone.name = name;
+    zone.startNs = startNs;
+    zone.durationNs = endNs - startNs;
+    buffer.writeIndex.store(index + 1, std::memory_order_release);
+}
+
+void Profiler::clear() {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    for (auto& buffer : buffers) {
+        buffer->writeIndex.store(0, std::memory_order_release);
+    }
+}
+
+std::size_t Profiler::getRecordedCount() const {
+    std::lock_guard<std::mutex> lock(registryMutex);
+    std::size_t total = 0;
+    for (const auto& buffer : buffers) {
+        total += buffer->writeIndex.load(std::memory_order_acquire);
+    }
+    return total;
+}
+
+bool Profiler::writeChromeTrace(const std::string& filename) const {
+    std::ofstream file(filename);
+    if (!file.is_open()) {
+        std::cerr << "Profiler: could not open trace file: " << filename << std::endl;
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(registryMutex);
+
+    file << std::fixed << std::setprecision(3);
+    file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+
+    for (const auto& buffer : buffers) {
+        std::size_t written = buffer->writeIndex.load(std::memory_order_acquire);
+        std::size_t count = std::min(written, BUFFER_CAPACITY);
+
+        // Oudste overlevende zone eerst (ring buffer kan overschreven zijn)
+        for (std::size_t i = written - count; i < written; ++i) {
+            const ProfileZone& zone = buffer->zones[i % BUFFER_CAPACITY];
+
+            if (!first) file << ",";
+            first = false;
+
+            // Trace Event formaat: complete event ("X"), tijden in microseconden
+            file << "\n{\"name\":\"" << zone.name << "\",\"cat\":\"pacman\",\"ph\":\"X\""
+                 << ",\"ts\":" << static_cast<double>(zone.startNs) / 1000.0
+                 << ",\"dur\":" << static_cast<double>(zone.durationNs) / 1000.0
+                 << ",\"pid\":1,\"tid\":" << buffer->threadId << "}";
+        }
+    }
+
+    file << "\n]}\n";
+    return true;
+}
+
+} // namespace pacman
@@ -1,8 +1,68 @@
 #include "representation/include/representation/Game.h"
+#include "representation/include/representation/OffscreenRenderer.h"
+#include "representation/include/representation/states/LevelState.h"
 #include <iostream>
+#include <cctype>
 #include <exception>
+#include <stdexcept>
+#include <string>
+
+int main(int argc, char* argv[]) {
+    using pacman::representation::LevelState;
+
+    // --offscreen: geen window, LevelState naar RenderTexture (of null target zonder GL)
+    bool offscreen = false;
+    pacman::representation::OffscreenConfig offscreenConfig;
+
+    // std::stoi/std::stof gooien bij een ongeldige waarde (bv. "--offscreen abc")
+    std::string arg;
+    try {
+        for (int i = 1; i < argc; ++i) {
+            arg = argv[i];
+
+            if (arg == "--threaded-sim") {
+                // Simulation op eigen thread, render thread tekent snapshots
+                LevelState::setThreadedSimulation(true);
+            } else if (arg == "--follow-camera") {
+                // Optioneel aantal zichtbare rijen (default CameraFollowSettings)
+                float rows = pacman::CameraFollowSettings().visibleRows;
+                if (i + 1 < argc && std::isdigit(static_cast<unsigned char>(argv[i + 1][0]))) {
+                    rows = std::stof(argv[++i]);
+                }
+                LevelState::setFollowCamera(rows);
+            } else if (arg == "--map" && i + 1 < argc) {
+                LevelState::setMapOverride(argv[++i]);
+            } else if (arg == "--offscreen" && i + 1 < argc) {
+                offscreen = true;
+                offscreenConfig.frames = std::stoi(argv[++i]);
+            } else if (arg == "--offscreen-null") {
+                offscreenConfig.forceNullTarget = true;
+            } else if (arg == "--script" && i + 1 < argc) {
+                offscreenConfig.scriptFile = argv[++i];
+            } else if (arg == "--dump-frames" && i + 1 < argc) {
+                offscreenConfig.dumpDirectory = argv[++i];
+            } else if (arg == "--dump-every" && i + 1 < argc) {
+                offscreenConfig.dumpEvery = std::stoi(argv[++i]);
+            } else if (arg == "--timings" && i + 1 < argc) {
+                offscreenConfig.timingsFile = argv[++i];
+            } else if (arg == "--render-budget-ms" && i + 1 < argc) {
+                offscreenConfig.renderBudgetMs = std::stof(argv[++i]);
+            }
+        }
+    } catch (const std::logic_error&) {  // std::invalid_argument, std::out_of_range
+        std::cerr << "Error: invalid numeric value for " << arg << std::endl;
+        return 1;
+    }
+
+    if (offscreen) {
+        try {
+            return pacman::representation::OffscreenRenderer(offscreenConfig).run();
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << std::endl;
+            return 1;
+        }
+    }
 
-int main() {
     try {
         pacman::representation::Game game;
         game.run();
@@ -1,5 +1,7 @@
 #pragma once
 #include "Animation.h"
+#include "AnimationSystem.h"
+#include <cstdint>
 #include <string>
 
 namespace pacman::representation {
@@ -9,18 +11,29 @@ namespace pacman::representation {
  *
  * === VERANTWOORDELIJKHEDEN ===
  * - Play animation (start vanaf frame 0)
- * - Update over tijd (frame switching op basis van elapsed time)
+ * - Update: huidige frame afleiden uit de gedeelde AnimationClock
  * - Provide current sprite naam (voor View rendering)
  *
+ * === GEDEELDE KLOK ===
+ * De controller telt zelf geen tijd meer op: AnimationSystem laat per
+ * Animation definitie één klok lopen. play() onthoudt de kloktijd (phase),
+ * update() rekent frame = (clock.time - phase) / frameDuration.
+ *
  * === USAGE IN VIEW ===
  *
  * // In View constructor:
  * animationController.play(SpriteManager::getInstance().getAnimation("pacman_walk_right"));
  *
  * // In View::onNotify(ENTITY_UPDATED):
- * animationController.update(event.deltaTime);
+ * animationController.update();
  * updateSpriteFromAnimation();  // Haal huidige sprite naam op
  *
+ * === FRAME VERSION (DIRTY FLAG) ===
+ * getFrameVersion() verhoogt bij play() en bij elke frame wissel. Views
+ * onthouden de versie die ze op hun sprite gezet hebben en slaan de
+ * SpriteManager lookup + setTextureRect over als er niets veranderd is
+ * (de meeste ENTITY_UPDATED events: een frame duurt meerdere ticks).
+ *
  *
  * === STATE MACHINE ===
  * playing = false:
@@ -28,8 +41,7 @@ namespace pacman::representation {
  * - getCurrentSpriteName() returns empty
  *
  * playing = true:
- * - Update elapsed time
- * - Switch frame bij elapsed >= frameDuration
+ * - Frame volgt de klok
  * - Loop of stop op laatste frame
  */
 class AnimationController {
@@ -42,24 +54,30 @@ public:
      *
      * Reset naar frame 0 en start playing.
      */
-    void play(const Animation& animation);
+    void play(const Animation& animation) { play(animation, 0.0f); }
 
     /**
-     * @brief Update animation state
-     * @param deltaTime Tijd sinds laatste update (seconden)
+     * @brief Start animation met phase offset
+     * @param phaseOffset Seconden die de animatie al "gelopen" heeft
      *
-     * Roep elke frame aan vanuit View::onNotify(ENTITY_UPDATED).
+     * Zelfde offset voor entities die dezelfde animation spelen = in sync.
+     */
+    void play(const Animation& animation, float phaseOffset);
+
+    /**
+     * @brief Sync huidige frame met de gedeelde klok
+     *
+     * Roep aan vanuit View::onNotify(ENTITY_UPDATED) (of vóór het tekenen).
+     * Geen eigen timer: enkel een deling, O(1) per controller.
      *
      * Proces:
-     * 1. Add deltaTime to elapsedTime
-     * 2. If elapsed >= frameDuration:
-     *    - Advance to next frame
-     *    - Carry overflow to next frame (smooth animation)
+     * 1. elapsed = clock.time - phase
+     * 2. frame = elapsed / frameDuration
      * 3. If reached end:
-     *    - Loop: reset to frame 0
+     *    - Loop: modulo frame count
      *    - No loop: stay on last frame, stop playing
      */
-    void update(float deltaTime);
+    void update();
 
     /**
      * @brief Verkrijg huidige sprite naam
@@ -67,12 +85,19 @@ public:
      *
      * Gebruikt door View om correct sprite rect te laden:
      *
-     * std::string spriteName = animationController.getCurrentSpriteName();
+     * const std::string& spriteName = animationController.getCurrentSpriteName();
      * sf::IntRect rect = SpriteManager::getInstance().getSpriteRect(spriteName);
      * sprite.setTextureRect(rect);
      *
+     * Reference blijft geldig zolang de Animation bestaat (owned door SpriteManager).
+     */
+    const std::string& getCurrentSpriteName() const;
+
+    /**
+     * @brief Teller die verandert telkens getCurrentSpriteName() kan veranderen
+     * @return 0 zolang er nooit een animation gespeeld is
      */
-    std::string getCurrentSpriteName() const;
+    std::uint32_t getFrameVersion() const { return frameVersion; }
 
     bool isPlaying() const { return playing; }
 
@@ -88,9 +113,11 @@ public:
 
 private:
     const Animation* currentAnimation = nullptr;  // Non-owning pointer (Animation owned door SpriteManager)
+    const AnimationClock* clock = nullptr;         // Gedeelde klok (owned door AnimationSystem)
+    double phase = 0.0;                            // clock.time waarop frame 0 begon
     int currentFrame = 0;                          // Huidige frame index (0-based)
-    float elapsedTime = 0.0f;                      // Tijd op huidige frame
     bool playing = false;                          // Playback state
+    std::uint32_t frameVersion = 0;                // ++ bij play() en frame wissel
 };
 
 } // namespace pacman::representation
\ No newline at end of file
@@ -0,0 +1,78 @@
+#pragma once
+#include "Animation.h"
+#include <cstddef>
+#include <deque>
+#include <unordered_map>
+
+namespace pacman::representation {
+
+/**
+ * @brief Gedeelde klok van één Animation definitie
+ *
+ * Adres blijft stabiel (deque): AnimationController houdt een pointer vast.
+ */
+struct AnimationClock {
+    double time = 0.0;  // Seconden sinds de klok bestaat (double: geen drift na uren spelen)
+};
+
+/**
+ * @brief Centrale animatie klokken (één per Animation definitie)
+ *
+ * === WAAROM ===
+ * Vroeger telde elke AnimationController zijn eigen timer op per
+ * ENTITY_UPDATED: honderd ghosts = honderd timers. Nu tikt LevelState één
+ * keer per frame advance(deltaTime); elke controller rekent zijn frame uit
+ * als (clock.time - phase) / frameDuration. N timer updates → één per
+ * animatie definitie (een dertigtal, ongeacht het aantal entities).
+ *
+ * === PHASE ===
+ * AnimationController::play() onthoudt de kloktijd als phase: de animatie
+ * start dus nog steeds op frame 0. Entities met dezelfde phase lopen in sync.
+ *
+ * === TIJD ===
+ * LevelState geeft dezelfde deltaTime als aan de World (0 tijdens READY);
+ * tijdens PausedState wordt niet geadvanced. Enkel de render/main thread.
+ *
+ * Usage:
+ * ```cpp
+ * AnimationSystem::getInstance().advance(deltaTime);  // 1x per frame
+ * ```
+ */
+class AnimationSystem {
+public:
+    /**
+     * @brief Verkrijg singleton instance (Meyers Singleton)
+     */
+    static AnimationSystem& getInstance() {
+        static AnimationSystem instance;
+        return instance;
+    }
+
+    // Delete copy/move (singleton)
+    AnimationSystem(const AnimationSystem&) = delete;
+    AnimationSystem& operator=(const AnimationSystem&) = delete;
+    AnimationSystem(AnimationSystem&&) = delete;
+    AnimationSystem& operator=(AnimationSystem&&) = delete;
+
+    /**
+     * @brief Klok van deze animation (aangemaakt bij eerste gebruik)
+     * @param animation Definitie (owned door SpriteManager, adres = key)
+     */
+    const AnimationClock& getClock(const Animation& animation);
+
+    /**
+     * @brief Laat alle klokken deltaTime verder lopen (1x per frame)
+     */
+    void advance(float deltaTime);
+
+    std::size_t getClockCount() const { return clocks.size(); }
+
+private:
+    AnimationSystem() = default;
+    ~AnimationSystem() = default;
+
+    std::deque<AnimationClock> clocks;                                  // Stabiele adressen
+    std::unordered_map<const Animation*, AnimationClock*> clockByAnimation;  // Enkel bij play()
+};
+
+} // namespace pacman::representation
@@ -0,0 +1,107 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <atomic>
+#include <string>
+#include <thread>
+
+namespace pacman::representation {
+
+/**
+ * @brief Laadt sprite sheet en font op een worker thread
+ *
+ * === WAAROM ===
+ * Game::Game laadde sprite.png (decode + GPU upload) en elke State zijn
+ * font synchroon: het window bleef zwart tot alles binnen was. Nu toont
+ * LoadingState meteen een frame terwijl de worker de bestanden decodeert.
+ *
+ * === THREADS ===
+ * - Worker: sf::Image::loadFromFile (PNG decode) en sf::Font::loadFromFile
+ *   (FreeType, geen GL). Raakt enkel image/font aan tot status DECODED.
+ * - Main thread: finishLoading() uploadt de image naar de SpriteManager
+ *   texture (GL context van het window) en definieert sprites/animaties.
+ *
+ * === FONT ===
+ * States kopiëren de gedeelde font (copyFont): sf::Font deelt zijn FreeType
+ * face via refcount, geen disk IO per State meer. Zonder startLoading()
+ * (bv. OffscreenRenderer) wordt de font bij de eerste copyFont() synchroon geladen.
+ *
+ * Usage:
+ * ```cpp
+ * auto& loader = AssetLoader::getInstance();
+ * loader.startLoading();             // LoadingState::onEnter
+ * if (loader.finishLoading()) { ... } // Elke frame in LoadingState::update
+ * ```
+ */
+class AssetLoader {
+public:
+    enum class Status {
+        IDLE,      // Niets gestart
+        LOADING,   // Worker decodeert
+        DECODED,   // Worker klaar, upload nog te doen (main thread)
+        READY,     // Texture geüpload, SpriteManager geïnitialiseerd
+        FAILED     // Sprite sheet niet leesbaar
+    };
+
+    static constexpr const char* SPRITE_SHEET_PATH = "../resources/sprites/sprite.png";
+    static constexpr const char* FONT_PATH = "../resources/fonts/Retro.ttf";
+
+    /**
+     * @brief Verkrijg singleton instance (Meyers Singleton)
+     */
+    static AssetLoader& getInstance() {
+        static AssetLoader instance;
+        return instance;
+    }
+
+    // Delete copy/move (singleton)
+    AssetLoader(const AssetLoader&) = delete;
+    AssetLoader& operator=(const AssetLoader&) = delete;
+    AssetLoader(AssetLoader&&) = delete;
+    AssetLoader& operator=(AssetLoader&&) = delete;
+
+    /**
+     * @brief Start de worker (idempotent)
+     */
+    void startLoading();
+
+    /**
+     * @brief Main thread: upload wat de worker gedecodeerd heeft
+     * @return true als alle assets klaar zijn
+     * @throws std::runtime_error als de sprite sheet niet geladen kon worden
+     */
+    bool finishLoading();
+
+    /**
+     * @brief Fractie van de stappen die klaar zijn (0..1, voor de loading bar)
+     */
+    float getProgress() const;
+
+    Status getStatus() const { return status.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Kopieer de gedeelde font naar font (main thread, na het laden)
+     * @return false als de font niet geladen kon worden
+     */
+    bool copyFont(sf::Font& font);
+
+private:
+    AssetLoader() = default;
+    ~AssetLoader();
+
+    static constexpr int TOTAL_STEPS = 3;  // Image decode, font, texture upload
+
+    std::thread worker;
+    std::atomic<Status> status{Status::IDLE};
+    std::atomic<int> completedSteps{0};
+
+    // Enkel worker tot DECODED, daarna enkel main thread
+    sf::Image spriteImage;
+    sf::Font sharedFont;
+    bool fontLoaded = false;
+    bool fontAttempted = false;  // Font maar één keer van disk (worker of synchroon)
+    std::string error;
+
+    void decode();
+};
+
+} // namespace pacman::representation
@@ -1,6 +1,7 @@
 #pragma once
 #include "logic/AbstractFactory.h"
 #include "logic/Camera.h"
+#include "logic/VisibilityIndex.h"
 #include "representation/views/EntityView.h"
 #include "logic/entities/Ghost.h"
 #include <SFML/Graphics.hpp>
@@ -21,18 +22,28 @@ namespace pacman::representation {
  * 3. ConcreteFactory maakt View (representation)
  * 4. View wordt geattached als Observer aan Model
  * 5. View wordt opgeslagen in views vector
- * 6. Model wordt gereturnd naar World (unique_ptr)
+ * 6. Model wordt gereturnd naar World (EntityPtr)
  *
  * === VIEW OWNERSHIP ===
- * - Models: owned door World (unique_ptr in vectors)
- * - Views: owned door ConcreteFactory (unique_ptr in views vector)
- * - Observer link: raw pointer (non-owning)
+ * - Models: owned door World (EntityPtr in vectors)
+ * - Views: owned door ConcreteFactory (EntityPtr in views vector)
+ * - Observer link: Model → View raw pointer (non-owning),
+ *   View → Model EntityHandle (resolved via de EntityRegistry)
+ * - Geheugen: Models en Views uit de LevelArena (setArena), anders heap
  *
  * === LIFETIME ===
- * ConcreteFactory moet outlive World (anders dangling observers).
- * In LevelState: factory als member, destructor volgorde:
- * 1. ~World() (destroy models, detach observers)
- * 2. ~ConcreteFactory() (destroy views)
+ * World en ConcreteFactory mogen in eender welke volgorde vernietigd worden:
+ * - Views die hun Model overleven zien een stale handle (getModel() == nullptr)
+ * - Views detachen zich in hun destructor als het Model nog bestaat
+ * Enkel de LevelArena (als gezet) moet beide outliven.
+ *
+ * === VISIBILITY CULLING ===
+ * collectVisibleViews() levert enkel de Views onder de camera rechthoek:
+ * - Map tiles (walls, coins, fruits): world AABB één keer in een VisibilityIndex
+ *   (één bucket per map tile), herbouwd na nieuwe Views. Tiles overlappen niet,
+ *   hun onderlinge volgorde maakt dus niet uit.
+ * - PacMan, ghosts en addView() Views (door): per query hun AABB testen (een
+ *   handvol), daarna getekend in getViews() volgorde, boven de tiles
  */
 class ConcreteFactory : public pacman::AbstractFactory {
 public:
@@ -44,17 +55,17 @@ public:
     ~ConcreteFactory() override = default;
 
     // AbstractFactory interface
-    std::unique_ptr<pacman::PacMan> createPacMan(const pacman::Position& pos) override;
-    std::unique_ptr<pacman::Coin> createCoin(const pacman::Position& pos) override;
-    std::unique_ptr<pacman::Fruit> createFruit(const pacman::Position& pos) override;
-    std::unique_ptr<pacman::Wall> createWall(const pacman::Position& pos) override;
+    pacman::EntityPtr<pacman::PacMan> createPacMan(const pacman::Position& pos) override;
+    pacman::EntityPtr<pacman::Coin> createCoin(const pacman::Position& pos) override;
+    pacman::EntityPtr<pacman::Fruit> createFruit(const pacman::Position& pos) override;
+    pacman::EntityPtr<pacman::Wall> createWall(const pacman::Position& pos) override;
 
     /**
      * @brief Creëer ghost met AI type op basis van kleur
      * @param world Reference naar World (ghosts hebben toegang nodig)
      * @param pos Spawn positie
      * @param color Ghost kleur → bepaalt AI subclass
-     * @return unique_ptr naar Ghost subclass
+     * @return EntityPtr naar Ghost subclass
      *
      * Color mapping:
      * - RED → RedGhost (direct chaser)
@@ -62,7 +73,7 @@ public:
      * - BLUE → BlueGhost (predictive)
      * - ORANGE → OrangeGhost (random)
      */
-    std::unique_ptr<pacman::Ghost> createGhost(pacman::World& world, const pacman::Position& pos,
+    pacman::EntityPtr<pacman::Ghost> createGhost(pacman::World& world, const pacman::Position& pos,
                                                pacman::GhostColor color) override;
 
     /**
@@ -71,12 +82,23 @@ public:
      *
      * Gebruikt door LevelState::render() om alle entities te tekenen.
      */
-    const std::vector<std::unique_ptr<EntityView>>& getViews() const { return views; }
+    const std::vector<pacman::EntityPtr<EntityView>>& getViews() const { return views; }
 
     /**
      * @brief Verwijder alle views (bij level reset)
      */
-    void clearViews() { views.clear(); }
+    void clearViews() {
+        views.clear();
+        unindexedViews.clear();
+        visibilityDirty = true;
+    }
+
+    /**
+     * @brief Views die de camera rechthoek (deels) overlappen, in teken volgorde
+     * @param frame Camera projectie van deze frame (visibleBounds + tileSize)
+     * @param visible Output (wordt geleegd)
+     */
+    void collectVisibleViews(const FrameTransform& frame, std::vector<EntityView*>& visible);
 
     /**
      * @brief Voeg custom view toe (voor DoorView)
@@ -85,12 +107,27 @@ public:
      * Gebruikt voor special cases die niet via create methods gaan.
      */
     void addView(std::unique_ptr<EntityView> view) {
-        views.push_back(std::move(view));
+        unindexedViews.push_back(static_cast<std::uint32_t>(views.size()));
+        views.push_back(pacman::adoptEntity(std::move(view)));
+        visibilityDirty = true;
     }
 
 private:
     std::weak_ptr<pacman::Camera> camera;  // Weak ptr: factory ownt camera niet
-    std::vector<std::unique_ptr<EntityView>> views;  // View ownership
+    std::vector<pacman::EntityPtr<EntityView>> views;  // View ownership
+
+    // Visibility culling (indices in views)
+    pacman::VisibilityIndex visibilityIndex;          // Map tiles
+    std::vector<std::uint32_t> unindexedViews;        // PacMan, ghosts, addView(): per query getest
+    std::vector<std::uint32_t> visibleIds;            // Scratch voor collectVisibleViews
+    bool visibilityDirty = true;
+
+    /**
+     * @brief Sla View op (map tile → index bij de volgende query, anders per query getest)
+     */
+    void addCreatedView(pacman::EntityPtr<EntityView> view, bool mapTile);
+
+    void rebuildVisibilityIndex();
 
     /**
      * @brief Template helper voor view creation en attachment
@@ -0,0 +1,58 @@
+#pragma once
+#include "logic/Camera.h"
+#include <SFML/Graphics.hpp>
+#include <cmath>
+
+namespace pacman::representation {
+
+/**
+ * @brief Camera projectie van één frame, één keer gemaakt in LevelState::render
+ *
+ * === WAAROM ===
+ * Elke View deed per draw een camera.lock() (atomic refcount) en
+ * Camera::worldToScreen, en getSpriteSize() bij elk animatie frame.
+ * Nu krijgen Views een const reference naar deze plain struct.
+ *
+ * === PIXEL SNAPPING ===
+ * toScreen() rondt af op hele pixels: de follow camera schuift met fracties
+ * van een pixel, zonder snapping shimmeren tile randen en sprites.
+ *
+ * === WORLD TRANSFORM ===
+ * worldTransform: world units → pixels (translatie ook gesnapt). Voor batches
+ * die in world coordinaten opgebouwd zijn: beweegt de camera, dan verandert
+ * enkel deze transform (RenderStates), de batch zelf niet.
+ */
+struct FrameTransform {
+    pacman::CameraTransform camera;
+    sf::Transform worldTransform;
+
+    static FrameTransform from(const pacman::Camera& source) {
+        FrameTransform frame;
+        frame.camera = source.getTransform();
+
+        // screen = screenCenter + (world - center) * scale
+        const auto& t = frame.camera;
+        frame.worldTransform.translate(std::round(t.screenCenterX - t.centerX * t.scale),
+                                       std::round(t.screenCenterY - t.centerY * t.scale));
+        frame.worldTransform.scale(t.scale, t.scale);
+        return frame;
+    }
+
+    /**
+     * @brief World positie → hele pixel
+     */
+    sf::Vector2f toScreen(const pacman::Position& worldPos) const {
+        pacman::Position screen = camera.worldToScreen(worldPos);
+        return sf::Vector2f(std::round(screen.x), std::round(screen.y));
+    }
+
+    /**
+     * @brief Schaal die een texture rect op spriteSize pixels brengt
+     */
+    sf::Vector2f spriteScale(const sf::IntRect& rect) const {
+        if (rect.width <= 0 || rect.height <= 0) return sf::Vector2f(1.0f, 1.0f);
+        return sf::Vector2f(camera.spriteSize / rect.width, camera.spriteSize / rect.height);
+    }
+};
+
+} // namespace pacman::representation
@@ -21,19 +21,22 @@ namespace pacman::representation {
  *   3. State update (game logic)
  *   4. Render (draw to window)
  *   5. Display (swap buffers)
+ *   6. FrameStats record (update/render/present tijden)
+ *
+ * Bij afsluiten: samenvatting naar FRAME_STATS_FILE, HighScoreService flush.
  *
  * === STARTUP SEQUENCE ===
  * 1. Window creation (1000x600)
  * 2. Framerate cap (60 FPS max)
- * 3. Sprite sheet loading
- * 4. Sprite/animation definitions
- * 5. Push MenuState
+ * 3. Push LoadingState (AssetLoader decodeert sprite sheet + font op een
+ *    worker thread; upload en sprite/animation definities op de main thread)
+ * 4. LoadingState → MenuState zodra alles klaar is
  */
 class Game {
 public:
     /**
-     * @brief Constructor - initialiseer SFML en sprite system
-     * @throws std::runtime_error als sprite sheet niet geladen kan worden
+     * @brief Constructor - maak window en push LoadingState
+     * @note Sprite sheet fouten komen uit run() (AssetLoader::finishLoading throwt)
      */
     Game();
     ~Game() = default;
@@ -65,7 +68,7 @@ private:
     void update(float deltaTime);
 
     /**
-     * @brief Render huidige state
+     * @brief Render huidige state (zonder display, dat meet run() apart)
      */
     void render();
 
@@ -73,6 +76,12 @@ private:
     static constexpr int WINDOW_WIDTH = 1000;
     static constexpr int WINDOW_HEIGHT = 600;
     static constexpr int FPS_LIMIT = 60;
+
+    // Output van Profiler (enkel met PACMAN_ENABLE_PROFILING)
+    static constexpr const char* PROFILE_TRACE_FILE = "profile_trace.json";
+
+    // Frame pacing samenvatting (FrameStats), geschreven bij afsluiten
+    static constexpr const char* FRAME_STATS_FILE = "frame_stats.txt";
 };
 
 } // namespace pacman::representation
\ No newline at end of file
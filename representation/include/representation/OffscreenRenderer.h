@@ -0,0 +1,91 @@
+#pragma once
+#include "logic/utils/Types.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace pacman::representation {
+
+/**
+ * @brief Instellingen van een offscreen run (main: --offscreen FRAMES ...)
+ */
+struct OffscreenConfig {
+    int frames = 600;                        // Maximum frames (stopt eerder bij level einde)
+    float deltaTime = 1.0f / 60.0f;          // Vaste stap: runs zijn herhaalbaar
+    int level = 1;
+    unsigned int seed = 12345;               // Random seed (zoals PacManHeadless)
+    std::string scriptFile;                  // Scripted input, leeg = geen input
+    std::string dumpDirectory;               // PNG frames, leeg = geen dump (enkel met GL)
+    int dumpEvery = 1;                       // Elke N-de frame dumpen
+    std::string timingsFile = "offscreen_timings.csv";
+    std::string summaryFile = "offscreen_frame_stats.txt";
+    float renderBudgetMs = 0.0f;             // > 0: exit code 2 als render p99 erboven zit
+    bool forceNullTarget = false;            // Ook met display geen GL (CPU kost alleen)
+};
+
+/**
+ * @brief Eén lijn van een input script: vanaf frame houdt de speler direction ingedrukt
+ */
+struct ScriptedInput {
+    int frame = 0;
+    pacman::Direction direction = pacman::Direction::NONE;
+};
+
+/**
+ * @brief Tekent een LevelState zonder window (CI frame-time regressies)
+ *
+ * === BACKENDS ===
+ * - GL: sf::RenderTexture (zelfde draw calls als het window, optioneel PNG dump)
+ * - Null: zonder display (geen DISPLAY op Linux) of met forceNullTarget.
+ *   Een sf::RenderTarget zonder context: SFML slaat elke draw over, maar
+ *   culling, batching en geometry updates lopen volledig. Zonder GL ook geen
+ *   sprite sheet texture en geen tekst (SFML zou een context aanmaken).
+ *
+ * === LOOP ===
+ * Per frame: script input → LevelState::update(deltaTime) →
+ * LevelState::renderTo(target) → optioneel readback + PNG.
+ * Vaste deltaTime en Random seed: dezelfde run geeft dezelfde frames.
+ *
+ * === OUTPUT ===
+ * - timingsFile: CSV per frame (frame, update_us, render_us, readback_us)
+ * - summaryFile: FrameStats samenvatting (p50/p95/p99/max per fase)
+ * - stdout: backend + FrameStats overlay tekst
+ * render_us meet de CPU kant (submission); GPU werk wacht pas op de readback.
+ *
+ * === SCRIPT FORMAAT ===
+ * ```
+ * # frame direction   (oplopend, '#' = commentaar)
+ * 130 LEFT
+ * 200 UP
+ * ```
+ */
+class OffscreenRenderer {
+public:
+    explicit OffscreenRenderer(OffscreenConfig config);
+
+    /**
+     * @brief Voer de run uit
+     * @return 0 = ok, 1 = fout (script, sprites, dump), 2 = render budget overschreden
+     */
+    int run();
+
+    /**
+     * @brief Lees een input script
+     * @param error Foutmelding (lijn nummer) als false
+     */
+    static bool loadScript(const std::string& filename, std::vector<ScriptedInput>& inputs, std::string& error);
+
+    // Zelfde afmetingen als het window (LevelState camera)
+    static constexpr unsigned int WIDTH = 1000;
+    static constexpr unsigned int HEIGHT = 600;
+
+private:
+    OffscreenConfig config;
+
+    /**
+     * @brief Is er een GL context mogelijk? (Linux: DISPLAY gezet)
+     */
+    bool canUseGL() const;
+};
+
+} // namespace pacman::representation
@@ -0,0 +1,133 @@
+#pragma once
+#include "logic/Camera.h"
+#include "logic/RenderSnapshot.h"
+#include "logic/VisibilityIndex.h"
+#include "logic/World.h"
+#include "representation/AnimationController.h"
+#include "representation/FrameTransform.h"
+#include "representation/SpriteBatch.h"
+#include <SFML/Graphics.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace pacman::representation {
+
+/**
+ * @brief Tekent een RenderSnapshot (threaded simulation, zie SimulationThread)
+ *
+ * === WAAROM GEEN VIEWS ===
+ * Views zijn observers: ze updaten sprites in onNotify(), dus op de thread die
+ * World::update() draait. Met de simulation op een eigen thread zou dat SFML
+ * state vanuit twee threads aanraken. SnapshotRenderer leest enkel de snapshot
+ * op de render thread; de World wordt enkel in de constructor gelezen.
+ *
+ * === STATISCHE LAYOUT ===
+ * Wall, coin en fruit posities + door worden één keer gekopieerd uit
+ * World::getComponents() (vóór SimulationThread::start()). Per frame komen
+ * enkel de collected flags uit de snapshot.
+ * Walls staan in één sf::VertexArray in world units, getekend met
+ * FrameTransform::worldTransform: de array verandert nooit, één draw call.
+ * Culling zoals ConcreteFactory: coins en fruits in een VisibilityIndex
+ * (ids: coins, dan fruits), PacMan/ghosts/door per frame getest.
+ *
+ * === VISUALS ===
+ * Zelfde als de Views: blauwe walls, gele coins, "fruit" sprite, PacMan walk/
+ * death animaties, ghost animaties per kleur + scared flicker (GhostView intervals).
+ * Animaties volgen de AnimationSystem klokken (LevelState advanced die op
+ * render deltaTime: vloeiend, ook als een tick uitvalt).
+ * Flicker timers lopen op render deltaTime.
+ * PacMan en ghosts gaan samen in één SpriteBatch (één draw call), de door
+ * wordt daarna getekend.
+ */
+class SnapshotRenderer {
+public:
+    /**
+     * @param world Geladen World (enkel gelezen in de constructor)
+     * @param camera Camera voor grid en shape groottes (enkel in de constructor)
+     */
+    SnapshotRenderer(const pacman::World& world, std::weak_ptr<pacman::Camera> camera);
+
+    /**
+     * @brief Update animaties naar de snapshot (posities volgen in draw())
+     * @param snapshot Laatste snapshot van de simulation
+     * @param deltaTime Render frame tijd (ghost flicker; ghosts staan stil tijdens READY en death animation)
+     */
+    void update(const pacman::RenderSnapshot& snapshot, float deltaTime);
+
+    /**
+     * @brief Teken level (walls, door, coins, fruits, ghosts, PacMan)
+     * @param frame Camera projectie van deze frame (LevelState::render)
+     */
+    void draw(sf::RenderTarget& target, const pacman::RenderSnapshot& snapshot, const FrameTransform& frame);
+
+private:
+    struct PacManSprite {
+        AnimationController animationController;
+        sf::Sprite sprite;
+        pacman::Direction lastDirection = pacman::Direction::NONE;
+        bool playingDeathAnimation = false;
+        int lastLives = 0;  // Daling = PACMAN_DIED
+        std::uint32_t appliedFrameVersion = 0;  // Dirty tracking zoals PacManView
+    };
+
+    struct GhostSprite {
+        AnimationController animationController;
+        sf::Sprite sprite;
+        pacman::GhostColor color = pacman::GhostColor::RED;
+        pacman::Direction lastDirection = pacman::Direction::NONE;
+        pacman::GhostState lastState = pacman::GhostState::IN_SPAWN;
+        float lastScaredTimeRemaining = 0.0f;  // Stijging = opnieuw scared
+        float flickerTimer = 0.0f;
+        bool flickerState = false;
+        std::uint32_t appliedFrameVersion = 0;  // Dirty tracking zoals GhostView
+        int appliedScaredFrame = -1;            // -1 = animation sprite, 0/1 = ghost_scared_1/2
+    };
+
+    float tileSize = 0.0f;  // Camera::getTileWorldSize() bij constructie
+
+    // Statische layout (kopie, World niet meer nodig na constructie)
+    std::vector<pacman::Position> coinPositions;
+    std::vector<pacman::Position> fruitPositions;
+    bool hasDoor = false;
+    pacman::Position doorPosition;
+
+    pacman::VisibilityIndex visibilityIndex;
+    std::vector<std::uint32_t> visibleIds;  // Scratch voor draw()
+
+    sf::VertexArray wallVertices;  // Quads in world units
+    sf::RectangleShape doorShape;
+    sf::CircleShape coinShape;
+    sf::Sprite fruitSprite;
+    SpriteBatch actorBatch;  // PacMan + ghosts
+
+    PacManSprite pacmanSprite;
+    std::vector<GhostSprite> ghostSprites;
+
+    void updatePacMan(const pacman::RenderSnapshot& snapshot);
+    /**
+     * @param deltaTime Render frame tijd (flicker timer)
+     * @param frozen READY of death animation: flicker en walk animatie staan stil
+     */
+    void updateGhost(GhostSprite& ghost, const pacman::RenderSnapshot::GhostSnapshot& state, float deltaTime,
+                     bool frozen);
+
+    void playGhostAnimation(GhostSprite& ghost, const pacman::RenderSnapshot::GhostSnapshot& state);
+
+    /**
+     * @brief Sprite rect + origin (schaal volgt in draw(), zoals de Views)
+     */
+    void applySpriteRect(sf::Sprite& sprite, const std::string& spriteName) const;
+
+    /**
+     * @brief Positie (pixel snapped) + schaal naar frame sprite size
+     */
+    void placeSprite(sf::Sprite& sprite, const pacman::Position& position, const FrameTransform& frame) const;
+
+    /**
+     * @brief Eén tile rond position (zelfde AABB als EntityView::getWorldBounds)
+     */
+    pacman::BoundingBox tileBounds(const pacman::Position& position) const;
+};
+
+} // namespace pacman::representation
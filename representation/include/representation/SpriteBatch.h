@@ -0,0 +1,69 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+
+namespace pacman::representation {
+
+/**
+ * @brief Verzamelt sprites van dezelfde texture in één draw call
+ *
+ * === WAAROM ===
+ * PacMan en elke ghost waren een eigen window.draw(sprite): één draw call
+ * (en state change) per actor, terwijl ze allemaal dezelfde sprite sheet
+ * (SpriteManager::getTexture()) samplen. Met honderden ghosts domineert dat
+ * de frame. add() zet de quad van de sprite (transform, texture rect, kleur)
+ * in één sf::VertexArray; flush() tekent alles met één draw call.
+ *
+ * === LAYERING ===
+ * Volgorde binnen de batch = volgorde van add(). Wie iets tekent dat NIET
+ * via de batch gaat, roept eerst flush() aan: zo blijft wat vroeger
+ * toegevoegd is eronder (bv. de door boven de ghosts).
+ *
+ * === PRIMITIVES ===
+ * Twee triangles per sprite (geen sf::Quads: deprecated in SFML 2.6).
+ * De VertexArray houdt zijn capacity: na de eerste frames geen allocaties.
+ *
+ * Usage:
+ * ```cpp
+ * batch.begin(window);
+ * batch.add(pacmanSprite);
+ * batch.add(ghostSprite);
+ * batch.flush();  // 1 draw call
+ * ```
+ */
+class SpriteBatch {
+public:
+    SpriteBatch();
+
+    /**
+     * @brief Start een frame op target (reset draw call teller)
+     */
+    void begin(sf::RenderTarget& target);
+
+    /**
+     * @brief Voeg sprite toe (andere texture dan de batch → eerst flush())
+     */
+    void add(const sf::Sprite& sprite);
+
+    /**
+     * @brief Teken wat verzameld is (no-op als de batch leeg is)
+     */
+    void flush();
+
+    std::size_t getSpriteCount() const { return vertices.getVertexCount() / VERTICES_PER_SPRITE; }
+
+    /**
+     * @brief Draw calls sinds begin() (statistiek)
+     */
+    std::size_t getDrawCalls() const { return drawCalls; }
+
+private:
+    static constexpr std::size_t VERTICES_PER_SPRITE = 6;
+
+    sf::VertexArray vertices;
+    const sf::Texture* texture = nullptr;  // Texture van de sprites in de batch
+    sf::RenderTarget* target = nullptr;    // Gezet in begin()
+    std::size_t drawCalls = 0;
+};
+
+} // namespace pacman::representation
@@ -68,6 +68,13 @@ public:
      */
     void loadSpriteSheet(const std::string& path);
 
+    /**
+     * @brief Upload een al gedecodeerde sprite sheet (AssetLoader, main thread)
+     * @param image Pixels (PNG decode gebeurde op de worker thread)
+     * @throws std::runtime_error als de texture niet aangemaakt kan worden
+     */
+    void loadSpriteSheet(const sf::Image& image);
+
     /**
      * @brief Verkrijg sprite sheet texture
      * @return Const reference naar texture
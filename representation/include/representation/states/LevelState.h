@@ -2,9 +2,14 @@
 #include "State.h"
 #include "logic/World.h"
 #include "logic/Camera.h"
+#include "logic/HeadlessFactory.h"
+#include "logic/SimulationThread.h"
 #include "representation/ConcreteFactory.h"
+#include "representation/SnapshotRenderer.h"
+#include "representation/SpriteBatch.h"
 #include <SFML/Graphics.hpp>
 #include <memory>
+#include <string>
 
 namespace pacman::representation {
 
@@ -23,16 +28,20 @@ namespace pacman::representation {
  * ```
  * LevelState owns:
  *   ├─ camera (shared_ptr, shared met World en Views)
- *   ├─ factory (shared_ptr, moet outlive World)
+ *   ├─ arena (unique_ptr, geheugen van alle Models en Views van dit level)
+ *   ├─ factory (shared_ptr, Views + EntityRegistry)
  *   └─ world (unique_ptr)
  * ```
  *
- * === DESTRUCTION ORDER (CRITICAL) ===
+ * === DESTRUCTION ORDER ===
  * ~LevelState():
+ * 0. simulation.reset() → stop en join de simulation thread (threaded mode)
  * 1. factory.reset()  → destroy Views (detach observers)
  * 2. world.reset()    → destroy Models
+ * 3. arena.reset()    → geef het level geheugen in één keer vrij
  *
- * Omgekeerde volgorde = crash (dangling observer pointers).
+ * Views houden EntityHandles vast (geen Model references): factory en world
+ * mogen ook omgekeerd vernietigd worden. De arena moet wel als laatste.
  *
  * === LETTERBOXING UI ===
  * If viewport heeft letterbox bars:
@@ -49,6 +58,42 @@ namespace pacman::representation {
  * - Na PacMan death (na death animation)
  *
  * Tijdens ready: World.update(0.0f) → geen movement.
+ *
+ * === THREADED SIMULATION (--threaded-sim) ===
+ * setThreadedSimulation(true) → World draait op een SimulationThread:
+ * - World via HeadlessFactory (geen Views), COMPONENTS storage
+ * - Input → SimulationCommand (SpscQueue), ESC pauzeert de simulation
+ * - update() leest de laatste RenderSnapshot (UI, READY, game state)
+ * - render() tekent via SnapshotRenderer
+ * READY timer en death detectie zitten dan in SimulationThread::step().
+ * ~LevelState() stopt de thread vóór world en arena vernietigd worden.
+ *
+ * === FOLLOW CAMERA (--follow-camera) ===
+ * Camera in CameraMode::FOLLOW (gezet vóór loadLevel, Views schalen bij
+ * constructie), snapTo(PacMan) na het laden, elke update() camera->update()
+ * vóór world->update(). render() tekent de World vóór de UI en maskeert
+ * daarna alles buiten de viewport.
+ *
+ * === CULLING ===
+ * render() tekent enkel Views onder Camera::getVisibleWorldBounds()
+ * (ConcreteFactory::collectVisibleViews, tile-bucketed VisibilityIndex).
+ *
+ * === FRAME TRANSFORM ===
+ * render() maakt één FrameTransform (Camera::getTransform() + sf::Transform)
+ * en geeft die aan elke View; Views locken de camera niet meer per draw.
+ *
+ * === SPRITE BATCHING ===
+ * Views die drawBatched() ondersteunen (PacMan, ghosts) gaan in spriteBatch;
+ * vóór elke View die zelf tekent wordt de batch geflusht, zodat de teken
+ * volgorde (tiles, actors, door) dezelfde blijft.
+ *
+ * === ANIMATIE KLOKKEN ===
+ * update() laat AnimationSystem één keer per frame lopen (zelfde deltaTime
+ * als de World, 0 tijdens READY); AnimationControllers lezen die klokken.
+ *
+ * === FRAME STATS OVERLAY ===
+ * F3 toggled overlay met FrameStats percentielen (p50/p95/p99/max)
+ * linksboven in de viewport. Tekst wordt elke 0.25s ververst.
  */
 class LevelState : public State {
 public:
@@ -60,9 +105,9 @@ public:
     LevelState(int level = 1, bool isTutorial = false, int carriedScore = 0);
 
     /**
-     * @brief Destructor - CRITICAL ORDER
+     * @brief Destructor - arena als laatste
      *
-     * Expliciet: factory.reset() VOOR world.reset().
+     * Views en Models hebben hun geheugen in de arena.
      */
     ~LevelState() override;
 
@@ -72,12 +117,81 @@ public:
     void update(float deltaTime) override;
     void render(sf::RenderWindow& window) override;
 
+    /**
+     * @brief Volgende waarschijnlijke LevelState (na VictoryState): altijd de
+     * normale map, ook na de tutorial
+     */
+    PreparationRequest getPreparationRequest() const override;
+
+    /**
+     * @brief Neem de vooraf gelezen map over als het dezelfde file is
+     */
+    void adoptPrepared(const PreparedResources& prepared) override;
+
+    /**
+     * @brief Map file voor een level (mapOverride > tutorial map.txt > map_big.txt)
+     */
+    static std::string mapFileFor(bool tutorial);
+
+    /**
+     * @brief Teken de level naar eender welk target (window, RenderTexture, OffscreenRenderer)
+     */
+    void renderTo(sf::RenderTarget& target);
+
+    /**
+     * @brief Offscreen run (OffscreenRenderer): vóór onEnter() aanroepen
+     * @param drawText false zonder GL context: sf::Text maakt glyph textures aan
+     *
+     * Level einde = finish(POP) i.p.v. VictoryState; de driver stopt dan.
+     */
+    void setOffscreen(bool drawText) {
+        offscreen = true;
+        textRendering = drawText;
+    }
+
+    /**
+     * @brief Stuur PacMan (toetsen of script), genegeerd tijdens READY
+     */
+    void applyDirection(pacman::Direction direction);
+
+    /**
+     * @brief Kies threaded simulation voor alle volgende levels (main: --threaded-sim)
+     */
+    static void setThreadedSimulation(bool enabled) { threadedSimulation = enabled; }
+    static bool isThreadedSimulation() { return threadedSimulation; }
+
+    /**
+     * @brief Follow camera voor alle volgende levels (main: --follow-camera [rows])
+     * @param visibleRows Tiles verticaal in beeld, 0 = hele map (FIT_MAP)
+     */
+    static void setFollowCamera(float visibleRows) { followCameraRows = visibleRows; }
+
+    /**
+     * @brief Speel deze map i.p.v. map.txt/map_big.txt (main: --map, bv. gegenereerde mazes)
+     */
+    static void setMapOverride(const std::string& mapFile) { mapOverride = mapFile; }
+
 private:
+    static bool threadedSimulation;
+    static float followCameraRows;
+    static std::string mapOverride;
+
     // Core game objects (ownership)
     std::shared_ptr<pacman::Camera> camera;
+    std::unique_ptr<pacman::LevelArena> arena;  // Moet outlive factory en world
     std::shared_ptr<ConcreteFactory> factory;
+    std::unique_ptr<pacman::HeadlessFactory> simulationFactory;  // Enkel threaded: World zonder Views
     std::unique_ptr<pacman::World> world;
 
+    // Threaded simulation (nullptr in de single-threaded mode)
+    std::unique_ptr<pacman::SimulationThread> simulation;  // Moet vóór world stoppen
+    std::unique_ptr<SnapshotRenderer> snapshotRenderer;
+    const pacman::RenderSnapshot* snapshot = nullptr;  // Geldig tot de volgende acquire
+    bool simulationPaused = false;
+
+    std::vector<EntityView*> visibleViews;  // render(): hergebruikt, enkel Views onder de camera
+    SpriteBatch spriteBatch;                // render(): PacMan + ghosts in één draw call
+
     int currentLevel;
     int carryScore = 0;
     int startingScore = 0;
@@ -112,7 +226,19 @@ private:
 
     bool wasPlayingDeathAnimation = false;
 
+    // Frame statistics overlay (F3)
+    bool showFrameStats = false;
+    float frameStatsRefreshTimer = 0.0f;
+    const float FRAME_STATS_REFRESH = 0.25f;  // Tekst niet elke frame herbouwen
+    sf::Text frameStatsText;
+    sf::RectangleShape frameStatsBackground;
+
     bool tutorialMode;
+    std::vector<std::string> preparedMapData;  // adoptPrepared(), leeg = map file zelf lezen
+
+    // Offscreen run (setOffscreen)
+    bool offscreen = false;
+    bool textRendering = true;
 
     void loadFont();
 
@@ -132,18 +258,42 @@ private:
      */
     void updateUI();
 
+    /**
+     * @brief Threaded update: RESUME na pauze, nieuwste snapshot, animaties
+     */
+    void updateFromSimulation(float deltaTime);
+
+    // Score/lives uit de snapshot (threaded) of rechtstreeks uit de World
+    int getCurrentScore() const;
+    int getCurrentLives() const;
+
+    /**
+     * @brief Overschilder alles buiten de viewport (follow mode: sprites aan de rand)
+     */
+    void maskOutsideViewport(sf::RenderTarget& target);
+
+    /**
+     * @brief target.draw(text), behalve als textRendering uit staat
+     */
+    void drawText(sf::RenderTarget& target, const sf::Text& text) const;
+
+    /**
+     * @brief Herbouw overlay tekst vanuit FrameStats singleton
+     */
+    void updateFrameStatsOverlay();
+
     /**
      * @brief Verwerk arrow key input → PacMan direction
      *
      * Alleen tijdens !showingReady.
-     * Direct call naar pacman->setDirection().
+     * Direct call naar pacman->setDirection(), threaded via SET_DIRECTION command.
      */
     void handlePlayerInput();
 
     /**
      * @brief Check game state en trigger transitions
      *
-     * Checks:
+     * Checks (threaded: uit de snapshot):
      * - world.isGameOver() → SWITCH VictoryState(false)
      * - world.isLevelComplete() → SWITCH VictoryState(true)
      */
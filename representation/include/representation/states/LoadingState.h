@@ -0,0 +1,52 @@
+#pragma once
+#include "State.h"
+#include <SFML/Graphics.hpp>
+
+namespace pacman::representation {
+
+/**
+ * @brief LoadingState - eerste state, toont voortgang terwijl AssetLoader laadt
+ *
+ * === UI ===
+ * - Progress bar (AssetLoader::getProgress())
+ * - Drie coins die na elkaar oplichten (teken van leven, ook als een stap lang duurt)
+ * Enkel shapes: de font is zelf nog aan het laden.
+ *
+ * === TIME TO FIRST FRAME ===
+ * Game::Game laadt niets meer: het window toont meteen deze state, het
+ * decoderen gebeurt op de worker thread van de AssetLoader.
+ *
+ * Ondertussen leest de StatePreparer de HighScoreService in (getPreparationRequest).
+ *
+ * === TRANSITION ===
+ * AssetLoader::finishLoading() == true → SWITCH MenuState
+ */
+class LoadingState : public State {
+public:
+    LoadingState();
+    ~LoadingState() override = default;
+
+    void onEnter() override;
+    void onExit() override;
+    void handleInput(const sf::Event& event, sf::RenderWindow& window) override;
+    void update(float deltaTime) override;
+    void render(sf::RenderWindow& window) override;
+
+    /**
+     * @brief Leaderboard inlezen terwijl de assets laden (MenuState toont hem meteen)
+     */
+    PreparationRequest getPreparationRequest() const override;
+
+private:
+    float elapsed = 0.0f;  // Coin animatie
+
+    sf::RectangleShape barBackground;
+    sf::RectangleShape barFill;
+    sf::CircleShape coin;
+
+    static constexpr float BAR_WIDTH = 400.0f;
+    static constexpr float BAR_HEIGHT = 16.0f;
+    static constexpr float COIN_INTERVAL = 0.25f;  // Seconden per oplichtende coin
+};
+
+} // namespace pacman::representation
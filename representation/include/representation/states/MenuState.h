@@ -39,6 +39,11 @@ public:
     void update(float deltaTime) override;
     void render(sf::RenderWindow& window) override;
 
+    /**
+     * @brief Volgende waarschijnlijke state: LevelState 1 (Play)
+     */
+    PreparationRequest getPreparationRequest() const override;
+
 private:
     sf::Font font;
     sf::Text titleText;
@@ -58,8 +63,8 @@ private:
     std::vector<sf::Text> highScoreTexts;  // Top 5 entries
 
     /**
-     * @brief Laad Retro.ttf font
-     * @throws std::runtime_error als font niet gevonden
+     * @brief Kopieer Retro.ttf font van de AssetLoader
+     * (waarschuwing op stderr als de font niet geladen kon worden)
      */
     void loadFont();
 
@@ -73,9 +78,9 @@ private:
     void setupTexts();
 
     /**
-     * @brief Laad highscores vanuit file
+     * @brief Bouw highscore teksten (HighScoreService, uit geheugen)
      *
-     * Gebruikt Score::getHighScores() voor top 5.
+     * Gebruikt HighScoreService::getHighScores() voor top 5.
      * Formatted als: "1.  NAME        SCORE"
      */
     void loadHighScores();
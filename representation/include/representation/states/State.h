@@ -1,4 +1,5 @@
 #pragma once
+#include "representation/states/StatePreparer.h"
 #include <SFML/Graphics.hpp>
 #include <memory>
 
@@ -111,6 +112,21 @@ public:
      */
     virtual void render(sf::RenderWindow& window) = 0;
 
+    /**
+     * @brief Wat deze state waarschijnlijk hierna nodig heeft
+     *
+     * StateManager vraagt dit na onEnter() en laat StatePreparer het op een
+     * worker thread inlezen terwijl deze state actief is. Default: niets.
+     */
+    virtual PreparationRequest getPreparationRequest() const { return {}; }
+
+    /**
+     * @brief Neem voorbereide data over (StateManager, vóór onEnter())
+     *
+     * Speculatief: controleer zelf of de data past (bv. zelfde map file).
+     */
+    virtual void adoptPrepared(const PreparedResources& /*prepared*/) {}
+
     // Transition getters (voor StateManager)
     bool isFinished() const { return finished; }
     StateAction getAction() const { return action; }
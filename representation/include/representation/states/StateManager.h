@@ -1,5 +1,6 @@
 #pragma once
 #include "State.h"
+#include "StatePreparer.h"
 #include <stack>
 #include <memory>
 
@@ -32,6 +33,12 @@ namespace pacman::representation {
  * 3. Call onExit/onEnter hooks
  *
  * Dit voorkomt state being destroyed tijdens eigen update.
+ *
+ * === SPECULATIEVE VOORBEREIDING ===
+ * Na elke onEnter() start de StatePreparer wat de nieuwe state verwacht
+ * (getPreparationRequest()) op een worker thread. Bij de volgende push/switch
+ * krijgt de nieuwe state dat resultaat vóór zijn onEnter() (adoptPrepared()):
+ * geen file IO meer op het moment van de transitie.
  */
 class StateManager {
 public:
@@ -42,7 +49,9 @@ public:
      * @brief Voeg state toe aan top van stack
      * @param state unique_ptr naar nieuwe state
      *
-     * Roept state->onEnter() aan.
+     * Geeft voorbereide data (adoptPrepared, enkel als de worker al klaar is:
+     * nooit wachten), roept state->onEnter() aan en
+     * start de voorbereiding voor de state daarna.
      * Oude top blijft in stack (suspended).
      */
     void pushState(std::unique_ptr<State> state);
@@ -87,11 +96,20 @@ public:
      */
     void render(sf::RenderWindow& window);
 
+    /**
+     * @brief Pop alle states (onExit + destructie), bv. bij afsluiten
+     *
+     * Stopt ook een SimulationThread van een LevelState: daarna schrijft
+     * geen andere thread nog profiler zones.
+     */
+    void clear();
+
     bool isEmpty() const { return states.empty(); }
     State* getCurrentState() const;
 
 private:
     std::stack<std::unique_ptr<State>> states;  // State stack (ownership)
+    StatePreparer preparer;  // Na states gedeclareerd: worker gejoind vóór states weg zijn
 
     /**
      * @brief Verwerk pending state transitions
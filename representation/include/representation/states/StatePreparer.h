@@ -0,0 +1,87 @@
+#pragma once
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace pacman::representation {
+
+/**
+ * @brief Wat een state verwacht dat de volgende state(s) nodig hebben
+ *
+ * Leeg (geen mapFile, geen highScores) = niets voor te bereiden.
+ */
+struct PreparationRequest {
+    std::string mapFile;      // Map van de waarschijnlijke volgende LevelState
+    bool highScores = false;  // HighScoreService::load() vooraf (eerste menu)
+
+    bool isEmpty() const { return mapFile.empty() && !highScores; }
+};
+
+/**
+ * @brief Resultaat van een speculatieve voorbereiding (enkel plain data)
+ */
+struct PreparedResources {
+    std::string mapFile;
+    std::vector<std::string> mapData;  // Leeg = niet gelukt, state laadt zelf synchroon
+};
+
+/**
+ * @brief Bereidt de volgende state voor op een worker thread (StateManager)
+ *
+ * === WAAROM ===
+ * Spatie op het VictoryState scherm construeerde een nieuwe LevelState die
+ * zijn map file las op de main thread, midden in een transitie. De active state beschrijft nu bij onEnter wat er
+ * waarschijnlijk volgt; de worker leest dat terwijl de state speelt.
+ *
+ * === WAT WEL / NIET ===
+ * - Wel: file IO en parsing (World::readMapFile, HighScoreService::load)
+ * - Niet: World, entities en Views: die registreren bij de Camera en de
+ *   AnimationSystem singleton (main thread) en blijven in LevelState::onEnter
+ *
+ * === THREADS ===
+ * De worker schrijft enkel `pending`; de main thread leest die pas na join().
+ * De main thread wacht nooit op een lopende worker: result() geeft dan
+ * nullptr en een nieuwe request wordt overgeslagen. Enkel de destructor joint.
+ *
+ * === SPECULATIEF ===
+ * De volgende state controleert zelf of het resultaat past (zelfde map file);
+ * zo niet laadt hij synchroon zoals vroeger.
+ */
+class StatePreparer {
+public:
+    StatePreparer() = default;
+    ~StatePreparer();
+
+    StatePreparer(const StatePreparer&) = delete;
+    StatePreparer& operator=(const StatePreparer&) = delete;
+
+    /**
+     * @brief Start een voorbereiding (lege request: vorige resultaat blijft)
+     * Loopt de vorige worker nog, dan wordt deze request genegeerd.
+     */
+    void request(const PreparationRequest& request);
+
+    /**
+     * @brief Laatste resultaat, blokkeert nooit
+     * @return nullptr als er niets voorbereid is of de worker nog loopt
+     */
+    const PreparedResources* result();
+
+    /**
+     * @brief true zodra de worker klaar is (result() geeft dan het resultaat)
+     */
+    bool isReady() const { return ready.load(std::memory_order_acquire); }
+
+private:
+    std::thread worker;
+    std::atomic<bool> ready{false};
+    bool hasResult = false;  // Main thread
+
+    PreparedResources pending;  // Worker tot join()
+
+    void prepare(PreparationRequest request);
+    void join();
+};
+
+} // namespace pacman::representation
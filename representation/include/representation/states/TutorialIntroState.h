@@ -38,6 +38,11 @@ public:
     void update(float deltaTime) override;
     void render(sf::RenderWindow& window) override;
 
+    /**
+     * @brief Volgende state: de tutorial LevelState
+     */
+    PreparationRequest getPreparationRequest() const override;
+
 private:
     sf::Font font;
     sf::Text titleText;
@@ -1,6 +1,5 @@
 #pragma once
 #include "State.h"
-#include "logic/Score.h"
 #include <SFML/Graphics.hpp>
 
 namespace pacman::representation {
@@ -24,8 +23,8 @@ namespace pacman::representation {
  * - Enter = save & menu
  *
  * === HIGHSCORE FLOW ===
- * 1. Constructor: check Score::isHighScore(finalScore)
- * 2. onEnter(): if highscore, set enteringName = true
+ * 1. onEnter(): check HighScoreService::isHighScore (geheugen),
+ *    if highscore set enteringName = true
  * 3. TextEntered events: build playerName string
  * 4. Enter pressed: saveHighScore(), finish(SWITCH, MenuState)
  *
@@ -52,13 +51,18 @@ public:
     void update(float deltaTime) override;
     void render(sf::RenderWindow& window) override;
 
+    /**
+     * @brief Volgende waarschijnlijke state: het volgende level (normale map)
+     */
+    PreparationRequest getPreparationRequest() const override;
+
 private:
     bool playerWon;
     int score;
     int level;
 
     // Highscore input state
-    bool isHighScore;
+    bool isHighScore = false;
     bool enteringName;
     std::string playerName;
 
@@ -84,9 +88,7 @@ private:
     void setupTexts();
 
     /**
-     * @brief Save highscore naar file
-     *
-     * Gebruikt Score::saveHighScore(playerName, score).
+     * @brief Save highscore (HighScoreService::submit, file write async)
      */
     void saveHighScore();
 };
@@ -19,13 +19,13 @@ namespace pacman::representation {
  */
 class CoinView : public EntityView {
 public:
-    CoinView(pacman::Coin& model, std::weak_ptr<pacman::Camera> camera);
+    CoinView(pacman::Coin& model, std::shared_ptr<pacman::EntityRegistry> registry,
+             std::weak_ptr<pacman::Camera> camera);
     ~CoinView() override = default;
 
-    void draw(sf::RenderWindow& window) override;
+    void draw(sf::RenderTarget& target, const FrameTransform& frame) override;
 
 private:
-    pacman::Coin& coinModel;  // Type-safe access
     sf::CircleShape circle;   // SFML shape (geen sprite)
 
     /**
@@ -6,21 +6,10 @@ namespace pacman::representation {
 /**
  * @brief View voor Door - special case zonder Model
  *
- * === PROBLEEM ===
+ * === ZONDER MODEL ===
  * Door is geen Entity (geen logica, alleen visual blokkade).
- * Maar EntityView verwacht EntityModel& in constructor.
- *
- * === OPLOSSING (HACK) ===
- * 1. Creëer static DummyModel (leeg EntityModel)
- * 2. Pass reference naar DummyModel aan EntityView constructor
- * 3. DoorView gebruikt eigen doorPosition ipv model.getPosition()
- *
- * === ALTERNATIEF (NIET GEBRUIKT) ===
- * Refactor EntityView hierarchy:
- * - StaticView (geen model)
- * - DynamicView (met model)
- *
- * Keuze: Hack is sneller en minder invasive change.
+ * DoorView gebruikt de model-loze EntityView constructor: geen handle,
+ * getModel() is altijd nullptr, positie komt uit doorPosition.
  *
  * === VISUAL ===
  * Brown rectangle (spawn exit).
@@ -33,12 +22,17 @@ public:
      * @param camera Weak pointer naar Camera
      * @param doorPos Positie van door in world coords
      *
-     * Gebruikt internal static DummyModel voor EntityView base.
+     * Geen Model: EntityView zonder handle.
      */
     DoorView(std::weak_ptr<pacman::Camera> camera, const pacman::Position& doorPos);
     ~DoorView() override = default;
 
-    void draw(sf::RenderWindow& window) override;
+    void draw(sf::RenderTarget& target, const FrameTransform& frame) override;
+
+    /**
+     * @brief Eén tile rond doorPosition
+     */
+    bool getWorldBounds(float tileSize, pacman::BoundingBox& bounds) const override;
 
     /**
      * @brief Empty implementation - door reageert niet op events
@@ -2,6 +2,8 @@
 #include "logic/EntityModel.h"
 #include "logic/Camera.h"
 #include "logic/patterns/Observer.h"
+#include "representation/FrameTransform.h"
+#include "representation/SpriteBatch.h"
 #include <SFML/Graphics.hpp>
 #include <memory>
 
@@ -17,7 +19,7 @@ namespace pacman::representation {
  *
  * === OBSERVER PATTERN ===
  * View observeert Model voor state changes:
- * - ENTITY_UPDATED: Update sprite positie
+ * - ENTITY_UPDATED: Update animatie (sprite rect)
  * - DIRECTION_CHANGED: Switch animatie
  * - GHOST_STATE_CHANGED: Switch scared/normal sprite
  *
@@ -27,23 +29,34 @@ namespace pacman::representation {
  * 3. Updates: Model notify → View onNotify
  * 4. Destruction: ~EntityView() detacht automatisch
  *
+ * === MODEL ACCESS (HANDLE) ===
+ * View houdt een EntityHandle vast, geen EntityModel&:
+ * - getModel<T>() resolved via de EntityRegistry (index + generation check)
+ * - Model al vernietigd → nullptr (View tekent/update dan niets)
+ * - Model verhuisd (pool) → handle wijst automatisch naar het nieuwe adres
+ * World en factory mogen dus in eender welke volgorde vernietigd worden.
+ *
  * === CAMERA USAGE ===
  * Camera is weak_ptr:
  * - View ownt camera niet
  * - Camera outlives views (owned door Game/LevelState)
- * - Lock before gebruik: auto cam = camera.lock()
+ * - Enkel gelockt bij constructie (shape groottes)
+ * Per frame krijgt draw() een FrameTransform (één keer berekend in
+ * LevelState::render): positie en sprite schaal komen daaruit, geen lock.
  */
 class EntityView : public pacman::Observer {
 public:
     /**
      * @brief Constructor
-     * @param model Reference naar Model (View observeert deze)
+     * @param model Model (View observeert deze, moet geregistreerd zijn in registry)
+     * @param registry Registry waarin model zijn handle heeft
      * @param camera Weak pointer naar Camera (voor coordinate conversie)
      */
-    EntityView(pacman::EntityModel& model, std::weak_ptr<pacman::Camera> camera);
+    EntityView(pacman::EntityModel& model, std::shared_ptr<pacman::EntityRegistry> registry,
+               std::weak_ptr<pacman::Camera> camera);
 
     /**
-     * @brief Destructor - detach van Model
+     * @brief Destructor - detach van Model (als dat nog bestaat)
      *
      * Zeer belangrijk: detach voorkomt dangling observer pointer.
      * Model mag niet notificeren naar destroyed View.
@@ -55,17 +68,28 @@ public:
      * @param event Event data (type, value, deltaTime)
      *
      * Typische gebruik:
-     * - ENTITY_UPDATED: updateSpritePosition(), update animation
+     * - ENTITY_UPDATED: update animation (positie volgt in draw())
      * - DIRECTION_CHANGED: switch animation
      * - Custom per subclass
      */
     void onNotify(const pacman::Event& event) override;
 
     /**
-     * @brief Render sprite naar window (pure virtual)
-     * @param window SFML window om naar te tekenen
+     * @brief Render sprite naar target (window of offscreen RenderTexture, pure virtual)
+     * @param target SFML render target om naar te tekenen
+     * @param frame Camera projectie van deze frame
+     */
+    virtual void draw(sf::RenderTarget& target, const FrameTransform& frame) = 0;
+
+    /**
+     * @brief Voeg sprite toe aan de batch i.p.v. zelf te tekenen
+     * @param batch SpriteBatch van deze frame
+     * @param frame Camera projectie van deze frame
+     * @return false als deze View niet batcht: caller flusht en roept draw() aan
+     *
+     * Default: niet batchen. PacMan en ghosts (sprite sheet) overriden.
      */
-    virtual void draw(sf::RenderWindow& window) = 0;
+    virtual bool drawBatched(SpriteBatch& batch, const FrameTransform& frame);
 
     /**
      * @brief Update view state
@@ -76,19 +100,42 @@ public:
      */
     virtual void update(float deltaTime);
 
+    /**
+     * @brief World AABB van wat deze View tekent (visibility culling)
+     * @param tileSize World grootte van één tile (CameraTransform::tileSize)
+     * @param bounds Output
+     * @return false als er niets te tekenen valt (Model weg)
+     *
+     * Default: één tile rond de Model positie (sprites zijn hoogstens één tile).
+     */
+    virtual bool getWorldBounds(float tileSize, pacman::BoundingBox& bounds) const;
+
 protected:
-    pacman::EntityModel& model;  // Reference naar Model (non-owning, Model owned door World)
+    /**
+     * @brief View zonder Model (bv. DoorView): getModel() geeft altijd nullptr
+     */
+    explicit EntityView(std::weak_ptr<pacman::Camera> camera);
+
+    /**
+     * @brief Model van deze View, nullptr als het niet (meer) bestaat
+     */
+    template <typename T = pacman::EntityModel>
+    T* getModel() const {
+        return registry ? registry->get<T>(handle) : nullptr;
+    }
+
+    std::shared_ptr<pacman::EntityRegistry> registry;  // Gedeeld: overleeft World en factory
+    pacman::EntityHandle handle;  // Model (non-owning, Model owned door World)
     std::weak_ptr<pacman::Camera> camera;  // Weak ptr: View ownt camera niet
 
     sf::Sprite sprite;  // SFML sprite voor rendering
 
     /**
-     * @brief Update sprite positie op basis van Model positie
+     * @brief Zet sprite op de Model positie (pixel snapped) en schaal naar spriteSize
      *
-     * Gebruikt Camera::worldToScreen() voor conversie.
-     * Roep aan in onNotify(ENTITY_UPDATED).
+     * Roep aan in draw(): de follow camera kan bewogen hebben sinds ENTITY_UPDATED.
      */
-    void updateSpritePosition();
+    void placeSprite(const FrameTransform& frame);
 };
 
 } // namespace pacman::representation
\ No newline at end of file
@@ -17,14 +17,14 @@ namespace pacman::representation {
  */
 class FruitView : public EntityView {
 public:
-    FruitView(pacman::Fruit& model, std::weak_ptr<pacman::Camera> camera);
+    FruitView(pacman::Fruit& model, std::shared_ptr<pacman::EntityRegistry> registry,
+              std::weak_ptr<pacman::Camera> camera);
     ~FruitView() override = default;
 
-    void draw(sf::RenderWindow& window) override;
+    void draw(sf::RenderTarget& target, const FrameTransform& frame) override;
     void update(float deltaTime) override;
 
 private:
-    pacman::Fruit& fruitModel;  // Type-safe access
 
     /**
      * @brief Laad sprite vanuit SpriteManager
@@ -34,10 +34,10 @@ private:
     void loadSprite();
 
     /**
-     * @brief Update sprite rect en scale
+     * @brief Update sprite rect en origin
      *
-     * Lookup "fruit" rect in SpriteManager,
-     * scale op basis van Camera::getSpriteSize().
+     * Lookup "fruit" rect in SpriteManager.
+     * Scale volgt in draw() (FrameTransform::spriteScale).
      */
     void updateSpriteFromTexture();
 };
@@ -31,17 +31,20 @@ namespace pacman::representation {
  * === STATE TRACKING ===
  * lastDirection: Detect direction changes → switch animation
  * lastState: Detect ON_MAP ↔ SCARED transitions → switch sprites
+ * appliedFrameVersion / appliedScaredFrame: wat nu op de sprite staat;
+ * setTextureRect enkel als frame, richting of state echt veranderd is
  */
 class GhostView : public EntityView {
 public:
-    GhostView(pacman::Ghost& model, std::weak_ptr<pacman::Camera> camera, pacman::GhostColor color);
+    GhostView(pacman::Ghost& model, std::shared_ptr<pacman::EntityRegistry> registry,
+              std::weak_ptr<pacman::Camera> camera, pacman::GhostColor color);
     ~GhostView() override = default;
 
-    void draw(sf::RenderWindow& window) override;
+    void draw(sf::RenderTarget& target, const FrameTransform& frame) override;
+    bool drawBatched(SpriteBatch& batch, const FrameTransform& frame) override;
     void onNotify(const pacman::Event& event) override;
 
 private:
-    pacman::Ghost& ghostModel;  // Type-safe access (non-owning)
     pacman::GhostColor ghostColor;
     AnimationController animationController;
     pacman::Direction lastDirection = pacman::Direction::NONE;
@@ -51,6 +54,10 @@ private:
     float flickerTimer = 0.0f;
     bool flickerState = false;  // false = frame 1, true = frame 2
 
+    // Dirty tracking: sprite rect enkel zetten als dit verandert
+    std::uint32_t appliedFrameVersion = 0;  // AnimationController::getFrameVersion()
+    int appliedScaredFrame = -1;            // -1 = animation sprite, 0/1 = ghost_scared_1/2
+
     /**
      * @brief Update animation op basis van state en direction
      *
@@ -25,17 +25,19 @@ namespace pacman::representation {
  */
 class PacManView : public EntityView {
 public:
-    PacManView(pacman::PacMan& model, std::weak_ptr<pacman::Camera> camera);
+    PacManView(pacman::PacMan& model, std::shared_ptr<pacman::EntityRegistry> registry,
+               std::weak_ptr<pacman::Camera> camera);
     ~PacManView() override = default;
 
-    void draw(sf::RenderWindow& window) override;
+    void draw(sf::RenderTarget& target, const FrameTransform& frame) override;
+    bool drawBatched(SpriteBatch& batch, const FrameTransform& frame) override;
     void onNotify(const pacman::Event& event) override;
 
 private:
-    pacman::PacMan* pacmanModel;  // Raw pointer voor type-safe access (non-owning)
     AnimationController animationController;
     pacman::Direction lastDirection = pacman::Direction::NONE;
     bool playingDeathAnimation = false;
+    std::uint32_t appliedFrameVersion = 0;  // Dirty tracking (AnimationController::getFrameVersion())
 
     /**
      * @brief Switch animation op basis van direction
@@ -53,7 +55,8 @@ private:
      * 1. Haal sprite naam op van animationController
      * 2. Lookup sprite rect in SpriteManager
      * 3. Update sprite texture rect
-     * 4. Scale sprite op basis van Camera::getSpriteSize()
+     * Scale en positie volgen in draw() (placeSprite).
+     * Doet niets als de frame version niet veranderd is.
      */
     void updateSpriteFromAnimation();
 };
@@ -0,0 +1,67 @@
+#pragma once
+#include "logic/entities/Ghost.h"
+#include "logic/utils/Types.h"
+#include <string>
+
+namespace pacman::representation::sprites {
+
+/**
+ * @brief Gedeelde sprite/animatie selectie voor de views en de SnapshotRenderer
+ *
+ * Beide render paden (observer views en snapshot) moeten exact dezelfde
+ * animaties kiezen; daarom staat de mapping hier en nergens anders.
+ */
+
+/// Scared frames: [0] = blauw, [1] = wit (flicker)
+inline const std::string SCARED_SPRITES[2] = {"ghost_scared_1", "ghost_scared_2"};
+
+inline constexpr const char* GHOST_SCARED_ANIMATION = "ghost_scared";
+
+/**
+ * @brief Walk animatie van PacMan voor een richting
+ * @return nullptr bij Direction::NONE (huidige animatie behouden)
+ */
+inline const char* pacmanWalkAnimation(pacman::Direction direction) {
+    switch (direction) {
+    case pacman::Direction::RIGHT: return "pacman_walk_right";
+    case pacman::Direction::LEFT:  return "pacman_walk_left";
+    case pacman::Direction::UP:    return "pacman_walk_up";
+    case pacman::Direction::DOWN:  return "pacman_walk_down";
+    default: return nullptr;
+    }
+}
+
+/**
+ * @brief Walk animatie van een (niet-scared) ghost, bv. "ghost_cyan_walk_up"
+ * NONE valt terug op rechts.
+ */
+inline std::string ghostWalkAnimation(pacman::GhostColor color, pacman::Direction direction) {
+    std::string colorPrefix;
+    switch (color) {
+    case pacman::GhostColor::RED:    colorPrefix = "ghost_red"; break;
+    case pacman::GhostColor::PINK:   colorPrefix = "ghost_pink"; break;
+    case pacman::GhostColor::BLUE:   colorPrefix = "ghost_cyan"; break;
+    case pacman::GhostColor::ORANGE: colorPrefix = "ghost_orange"; break;
+    }
+
+    switch (direction) {
+    case pacman::Direction::UP:    return colorPrefix + "_walk_up";
+    case pacman::Direction::DOWN:  return colorPrefix + "_walk_down";
+    case pacman::Direction::LEFT:  return colorPrefix + "_walk_left";
+    default:                       return colorPrefix + "_walk_right";
+    }
+}
+
+/**
+ * @brief Flicker interval voor scared ghosts (exponentieel sneller naar het einde)
+ * Boven 3s resterend geen flicker (stevig blauw).
+ */
+inline float flickerInterval(float remainingTime) {
+    if (remainingTime > 3.0f) return 999.0f;
+    if (remainingTime > 2.0f) return 0.5f;
+    if (remainingTime > 1.0f) return 0.25f;
+    if (remainingTime > 0.5f) return 0.15f;
+    return 0.08f;  // Zeer snel aan einde
+}
+
+} // namespace pacman::representation::sprites
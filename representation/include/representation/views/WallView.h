@@ -19,13 +19,13 @@ namespace pacman::representation {
  */
 class WallView : public EntityView {
 public:
-    WallView(pacman::Wall& model, std::weak_ptr<pacman::Camera> camera);
+    WallView(pacman::Wall& model, std::shared_ptr<pacman::EntityRegistry> registry,
+             std::weak_ptr<pacman::Camera> camera);
     ~WallView() override = default;
 
-    void draw(sf::RenderWindow& window) override;
+    void draw(sf::RenderTarget& target, const FrameTransform& frame) override;
 
 private:
-    pacman::Wall& wallModel;  // Type-safe access
     sf::RectangleShape rectangle;
 
     /**
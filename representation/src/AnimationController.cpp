@@ -2,7 +2,7 @@
 
 namespace pacman::representation {
 
-void AnimationController::play(const Animation& animation) {
+void AnimationController::play(const Animation& animation, float phaseOffset) {
     // Safety check: make sure the animation is valid
     if (!animation.isValid()) {
         playing = false;
@@ -11,14 +11,18 @@ void AnimationController::play(const Animation& animation) {
     
     // Set up the controller to play this animation
     currentAnimation = &animation;
-    currentFrame = 0;           // Start at first frame
-    elapsedTime = 0.0f;         // Reset timer
+    clock = &AnimationSystem::getInstance().getClock(animation);
+    phase = clock->time - phaseOffset;  // Frame 0 begint nu (min de offset)
+    currentFrame = 0;
     playing = true;             // Start playing
+    ++frameVersion;             // Sprite moet opnieuw gezet worden
+
+    update();                   // Offset kan al voorbij frame 0 liggen
 }
 
-void AnimationController::update(float deltaTime) {
+void AnimationController::update() {
     // Don't do anything if we're not playing
-    if (!playing || currentAnimation == nullptr) {
+    if (!playing || currentAnimation == nullptr || clock == nullptr) {
         return;
     }
     
@@ -28,40 +32,40 @@ void AnimationController::update(float deltaTime) {
         return;
     }
     
-    // Add time to our timer
-    elapsedTime += deltaTime;
-    
-    // Check if it's time to move to the next frame
-    if (elapsedTime >= currentAnimation->frameDuration) {
-        // Move time overflow to next frame (important for smooth animation!)
-        elapsedTime -= currentAnimation->frameDuration;
-        
-        // Move to next frame
-        currentFrame++;
-        
-        // Check if we've reached the end of the animation
-        if (currentFrame >= static_cast<int>(currentAnimation->frameNames.size())) {
-            if (currentAnimation->loop) {
-                // Loop back to the beginning
-                currentFrame = 0;
-            } else {
-                // Non-looping animation: stay on last frame and stop playing
-                currentFrame = currentAnimation->frameNames.size() - 1;
-                playing = false;
-            }
+    // Frame volgt uit de gedeelde klok
+    const int frameCount = static_cast<int>(currentAnimation->frameNames.size());
+    double elapsed = clock->time - phase;
+    int frame = elapsed > 0.0 ? static_cast<int>(elapsed / currentAnimation->frameDuration) : 0;
+
+    // Check if we've reached the end of the animation
+    if (frame >= frameCount) {
+        if (currentAnimation->loop) {
+            // Loop back to the beginning
+            frame %= frameCount;
+        } else {
+            // Non-looping animation: stay on last frame and stop playing
+            frame = frameCount - 1;
+            playing = false;
         }
     }
+
+    if (frame != currentFrame) {
+        currentFrame = frame;
+        ++frameVersion;
+    }
 }
 
-std::string AnimationController::getCurrentSpriteName() const {
+const std::string& AnimationController::getCurrentSpriteName() const {
+    static const std::string empty;
+
     // Safety checks
     if (currentAnimation == nullptr || !currentAnimation->isValid()) {
-        return "";  // Return empty string if no valid animation
+        return empty;  // Return empty string if no valid animation
     }
     
     // Make sure currentFrame is within bounds
     if (currentFrame < 0 || currentFrame >= static_cast<int>(currentAnimation->frameNames.size())) {
-        return "";
+        return empty;
     }
     
     // Return the sprite name for the current frame
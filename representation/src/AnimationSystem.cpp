@@ -0,0 +1,22 @@
+#include "representation/AnimationSystem.h"
+
+namespace pacman::representation {
+
+const AnimationClock& AnimationSystem::getClock(const Animation& animation) {
+    auto it = clockByAnimation.find(&animation);
+    if (it != clockByAnimation.end()) {
+        return *it->second;
+    }
+
+    clocks.emplace_back();
+    clockByAnimation.emplace(&animation, &clocks.back());
+    return clocks.back();
+}
+
+void AnimationSystem::advance(float deltaTime) {
+    for (auto& clock : clocks) {
+        clock.time += deltaTime;
+    }
+}
+
+} // namespace pacman::representation
@@ -0,0 +1,85 @@
+#include "representation/AssetLoader.h"
+#include "representation/SpriteManager.h"
+#include <iostream>
+#include <stdexcept>
+
+namespace pacman::representation {
+
+AssetLoader::~AssetLoader() {
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+void AssetLoader::startLoading() {
+    Status expected = Status::IDLE;
+    if (!status.compare_exchange_strong(expected, Status::LOADING, std::memory_order_acq_rel)) {
+        return;  // Al gestart of klaar
+    }
+    worker = std::thread(&AssetLoader::decode, this);
+}
+
+void AssetLoader::decode() {
+    bool imageLoaded = spriteImage.loadFromFile(SPRITE_SHEET_PATH);
+    if (!imageLoaded) {
+        error = std::string("Failed to load sprite sheet: ") + SPRITE_SHEET_PATH;
+    }
+    completedSteps.fetch_add(1, std::memory_order_relaxed);
+
+    if (!fontAttempted) {
+        fontAttempted = true;
+        fontLoaded = sharedFont.loadFromFile(FONT_PATH);
+    }
+    completedSteps.fetch_add(1, std::memory_order_relaxed);
+
+    status.store(imageLoaded ? Status::DECODED : Status::FAILED, std::memory_order_release);
+}
+
+bool AssetLoader::finishLoading() {
+    Status current = status.load(std::memory_order_acquire);
+    if (current == Status::READY) return true;
+    if (current == Status::IDLE || current == Status::LOADING) return false;
+
+    if (worker.joinable()) {
+        worker.join();
+    }
+
+    if (current == Status::FAILED) {
+        std::cerr << "ERROR: Failed to initialize sprite system: " << error << std::endl;
+        std::cerr << "Make sure sprite.png is in resources/sprites/ folder!" << std::endl;
+        throw std::runtime_error(error);
+    }
+
+    // GPU upload op de main thread (context van het window)
+    auto& spriteManager = SpriteManager::getInstance();
+    spriteManager.loadSpriteSheet(spriteImage);
+    spriteManager.initialize();
+    spriteImage = sf::Image();  // Pixels staan nu in de texture
+
+    completedSteps.fetch_add(1, std::memory_order_relaxed);
+    status.store(Status::READY, std::memory_order_release);
+    return true;
+}
+
+float AssetLoader::getProgress() const {
+    return static_cast<float>(completedSteps.load(std::memory_order_relaxed)) / TOTAL_STEPS;
+}
+
+bool AssetLoader::copyFont(sf::Font& font) {
+    Status current = status.load(std::memory_order_acquire);
+    if (current == Status::IDLE) {
+        // Geen async load gestart: synchroon, één keer (enkel de font)
+        if (!fontAttempted) {
+            fontAttempted = true;
+            fontLoaded = sharedFont.loadFromFile(FONT_PATH);
+        }
+    } else if (current == Status::LOADING && worker.joinable()) {
+        worker.join();  // Font nodig vóór de loading screen klaar is: wachten
+    }
+
+    if (!fontLoaded) return false;
+    font = sharedFont;
+    return true;
+}
+
+} // namespace pacman::representation
@@ -4,6 +4,7 @@
 #include "representation/views/FruitView.h"
 #include "representation/views/WallView.h"
 #include "representation/views/GhostView.h"
+#include "logic/utils/Profiler.h"
 
 #include "logic/entities/RedGhost.h"
 #include "logic/entities/PinkGhost.h"
@@ -16,67 +17,124 @@ ConcreteFactory::ConcreteFactory(std::shared_ptr<pacman::Camera> camera)
     : camera(camera) {
 }
 
-std::unique_ptr<pacman::PacMan> ConcreteFactory::createPacMan(const pacman::Position& pos) {
-    auto pacman = std::make_unique<pacman::PacMan>(pos);
+pacman::EntityPtr<pacman::PacMan> ConcreteFactory::createPacMan(const pacman::Position& pos) {
+    auto pacman = makeModel<pacman::PacMan>(pos);
 
-    auto view = std::make_unique<PacManView>(*pacman, camera);
+    auto view = pacman::makeEntity<PacManView>(arena, *pacman, registry, camera);
     pacman->attach(view.get());
-    views.push_back(std::move(view));
+    addCreatedView(std::move(view), false);
 
     return pacman;
 }
 
-std::unique_ptr<pacman::Coin> ConcreteFactory::createCoin(const pacman::Position& pos) {
-    auto coin = std::make_unique<pacman::Coin>(pos);
-    auto view = std::make_unique<CoinView>(*coin, camera);
+pacman::EntityPtr<pacman::Coin> ConcreteFactory::createCoin(const pacman::Position& pos) {
+    auto coin = makeModel<pacman::Coin>(pos);
+    auto view = pacman::makeEntity<CoinView>(arena, *coin, registry, camera);
     coin->attach(view.get());
-    views.push_back(std::move(view));
+    addCreatedView(std::move(view), true);
     return coin;
 }
 
-std::unique_ptr<pacman::Fruit> ConcreteFactory::createFruit(const pacman::Position& pos) {
-    auto fruit = std::make_unique<pacman::Fruit>(pos);
+pacman::EntityPtr<pacman::Fruit> ConcreteFactory::createFruit(const pacman::Position& pos) {
+    auto fruit = makeModel<pacman::Fruit>(pos);
 
-    auto view = std::make_unique<FruitView>(*fruit, camera);
+    auto view = pacman::makeEntity<FruitView>(arena, *fruit, registry, camera);
     fruit->attach(view.get());
-    views.push_back(std::move(view));
+    addCreatedView(std::move(view), true);
 
     return fruit;
 }
 
-std::unique_ptr<pacman::Wall> ConcreteFactory::createWall(const pacman::Position& pos) {
-    auto wall = std::make_unique<pacman::Wall>(pos);
+pacman::EntityPtr<pacman::Wall> ConcreteFactory::createWall(const pacman::Position& pos) {
+    auto wall = makeModel<pacman::Wall>(pos);
 
-    auto view = std::make_unique<WallView>(*wall, camera);
+    auto view = pacman::makeEntity<WallView>(arena, *wall, registry, camera);
     wall->attach(view.get());
-    views.push_back(std::move(view));
+    addCreatedView(std::move(view), true);
 
     return wall;
 }
 
-std::unique_ptr<pacman::Ghost> ConcreteFactory::createGhost(pacman::World& world, const pacman::Position& pos, pacman::GhostColor color) {
-    std::unique_ptr<pacman::Ghost> ghost;
+pacman::EntityPtr<pacman::Ghost> ConcreteFactory::createGhost(pacman::World& world, const pacman::Position& pos, pacman::GhostColor color) {
+    pacman::EntityPtr<pacman::Ghost> ghost;
 
     switch (color) {
     case pacman::GhostColor::RED:
-        ghost = std::make_unique<pacman::RedGhost>(world, pos);
+        ghost = makeModel<pacman::RedGhost>(world, pos);
         break;
     case pacman::GhostColor::PINK:
-        ghost = std::make_unique<pacman::PinkGhost>(world, pos);
+        ghost = makeModel<pacman::PinkGhost>(world, pos);
         break;
     case pacman::GhostColor::BLUE:
-        ghost = std::make_unique<pacman::BlueGhost>(world, pos);
+        ghost = makeModel<pacman::BlueGhost>(world, pos);
         break;
     case pacman::GhostColor::ORANGE:
-        ghost = std::make_unique<pacman::OrangeGhost>(world, pos);
+        ghost = makeModel<pacman::OrangeGhost>(world, pos);
         break;
     }
 
-    auto view = std::make_unique<GhostView>(*ghost, camera, color);
+    auto view = pacman::makeEntity<GhostView>(arena, *ghost, registry, camera, color);
     ghost->attach(view.get());
-    views.push_back(std::move(view));
+    addCreatedView(std::move(view), false);
 
     return ghost;
 }
 
-} // namespace pacman::representation
\ No newline at end of file
+void ConcreteFactory::addCreatedView(pacman::EntityPtr<EntityView> view, bool mapTile) {
+    if (!mapTile) {
+        unindexedViews.push_back(static_cast<std::uint32_t>(views.size()));
+    }
+    views.push_back(std::move(view));
+    visibilityDirty = true;
+}
+
+void ConcreteFactory::rebuildVisibilityIndex() {
+    visibilityDirty = false;
+
+    auto cam = camera.lock();
+    if (!cam) return;
+
+    float tileSize = cam->getTileWorldSize();
+    visibilityIndex.setGrid(-cam->getWorldWidth(), -cam->getWorldHeight(), tileSize,
+                            cam->getMapCols(), cam->getMapRows());
+
+    pacman::BoundingBox bounds(0.0f, 0.0f, 0.0f, 0.0f);
+    auto unindexedIt = unindexedViews.begin();
+    for (std::uint32_t i = 0; i < views.size(); ++i) {
+        if (unindexedIt != unindexedViews.end() && *unindexedIt == i) {
+            ++unindexedIt;
+            continue;
+        }
+        if (views[i]->getWorldBounds(tileSize, bounds)) {
+            visibilityIndex.insert(i, bounds);
+        }
+    }
+    visibilityIndex.build();
+}
+
+void ConcreteFactory::collectVisibleViews(const FrameTransform& frame, std::vector<EntityView*>& visible) {
+    PACMAN_PROFILE_SCOPE("ConcreteFactory::collectVisibleViews");
+
+    if (visibilityDirty) {
+        rebuildVisibilityIndex();
+    }
+
+    visible.clear();
+
+    const pacman::BoundingBox area = frame.camera.visibleBounds();
+
+    // Eerst map tiles (volgorde onderling irrelevant), daarna de rest in aanmaak volgorde
+    visibilityIndex.query(area, visibleIds);
+    for (std::uint32_t id : visibleIds) {
+        visible.push_back(views[id].get());
+    }
+
+    pacman::BoundingBox bounds(0.0f, 0.0f, 0.0f, 0.0f);
+    for (std::uint32_t id : unindexedViews) {
+        if (views[id]->getWorldBounds(frame.camera.tileSize, bounds) && bounds.intersects(area)) {
+            visible.push_back(views[id].get());
+        }
+    }
+}
+
+} // namespace pacman::representation
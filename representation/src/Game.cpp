@@ -1,50 +1,80 @@
 #include "representation/Game.h"
-#include "representation/states/MenuState.h"
-#include "representation/SpriteManager.h"
+#include "representation/states/LoadingState.h"
+#include "logic/HighScoreService.h"
+#include "logic/utils/FrameStats.h"
+#include "logic/utils/Profiler.h"
 #include "logic/utils/Stopwatch.h"
+#include <chrono>
 #include <iostream>
 
 namespace pacman::representation {
 
+namespace {
+using Clock = std::chrono::steady_clock;
+
+std::uint64_t toMicroseconds(Clock::duration duration) {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+}
+} // namespace
+
 Game::Game()
     : window(sf::VideoMode(WINDOW_WIDTH, WINDOW_HEIGHT), "PacMan - Advanced Programming") {
 
     window.setFramerateLimit(FPS_LIMIT);
 
-    auto& spriteManager = SpriteManager::getInstance();
-
-    try {
-        // Load the sprite sheet
-        spriteManager.loadSpriteSheet("../resources/sprites/sprite.png");
-
-        // Initialize all sprites and animations
-        spriteManager.initialize();
-
-    } catch (const std::exception& e) {
-        std::cerr << "ERROR: Failed to initialize sprite system: " << e.what() << std::endl;
-        std::cerr << "Make sure sprite.png is in resources/sprites/ folder!" << std::endl;
-        throw;  // Re-throw to prevent game from starting without sprites
-    }
-    
-    // Start with MenuState
-    stateManager.pushState(std::make_unique<MenuState>());
+    // Assets laden op de AssetLoader worker: eerste frame meteen na window creation
+    stateManager.pushState(std::make_unique<LoadingState>());
 }
 
 void Game::run() {
     auto& stopwatch = pacman::Stopwatch::getInstance();
     stopwatch.reset();
     
+    auto& frameStats = pacman::FrameStats::getInstance();
+    frameStats.setTargetFrameTime(1.0f / FPS_LIMIT);
+
     while (window.isOpen() && !stateManager.isEmpty()) {
         stopwatch.update();
         float deltaTime = stopwatch.getDeltaTime();
-        
+
+        auto frameStart = Clock::now();
+
         processEvents();
+
+        auto updateStart = Clock::now();
         update(deltaTime);
+
+        auto renderStart = Clock::now();
         render();
+
+        auto presentStart = Clock::now();
+        window.display();
+        auto frameEnd = Clock::now();
+
+        pacman::FrameSample sample;
+        sample.updateUs = toMicroseconds(renderStart - updateStart);
+        sample.renderUs = toMicroseconds(presentStart - renderStart);
+        sample.presentUs = toMicroseconds(frameEnd - presentStart);
+        sample.frameUs = toMicroseconds(frameEnd - frameStart);
+        frameStats.record(sample);
     }
+
+    frameStats.writeSummary(FRAME_STATS_FILE);
+    pacman::HighScoreService::getInstance().flush();  // Laatste async highscore write afwachten
+
+#ifdef PACMAN_PROFILING
+    // Eerst de states weg (--threaded-sim: SimulationThread gejoind), dan zijn
+    // geen zones meer actief tijdens het exporteren van de ring buffers
+    stateManager.clear();
+    if (pacman::Profiler::getInstance().writeChromeTrace(PROFILE_TRACE_FILE)) {
+        std::cout << "Profiler trace written to " << PROFILE_TRACE_FILE << std::endl;
+    }
+#endif
 }
 
 void Game::processEvents() {
+    PACMAN_PROFILE_SCOPE("Game::processEvents");
+
     sf::Event event;
     while (window.pollEvent(event)) {
         if (event.type == sf::Event::Closed) {
@@ -62,7 +92,6 @@ void Game::update(float deltaTime) {
 void Game::render() {
     window.clear();
     stateManager.render(window);
-    window.display();
 }
 
 } // namespace pacman::representation
\ No newline at end of file
@@ -0,0 +1,236 @@
+#include "representation/OffscreenRenderer.h"
+#include "representation/SpriteManager.h"
+#include "representation/states/LevelState.h"
+#include "logic/utils/FrameStats.h"
+#include "logic/utils/Random.h"
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+
+namespace pacman::representation {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+std::uint64_t toMicroseconds(Clock::duration duration) {
+    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(duration).count());
+}
+
+/**
+ * @brief Render target zonder GL context
+ *
+ * RenderTarget tekent enkel als setActive(true) lukt: hier nooit, dus elke
+ * draw is een no-op na de CPU kant (Shape/Text/VertexArray → RenderTarget).
+ */
+class NullRenderTarget : public sf::RenderTarget {
+public:
+    NullRenderTarget(unsigned int width, unsigned int height)
+        : size(width, height) {
+        initialize();  // Default view, geen GL
+    }
+
+    sf::Vector2u getSize() const override { return size; }
+
+    bool setActive(bool active = true) override {
+        (void)active;
+        return false;
+    }
+
+private:
+    sf::Vector2u size;
+};
+
+bool parseDirection(const std::string& name, pacman::Direction& direction) {
+    if (name == "UP") direction = pacman::Direction::UP;
+    else if (name == "DOWN") direction = pacman::Direction::DOWN;
+    else if (name == "LEFT") direction = pacman::Direction::LEFT;
+    else if (name == "RIGHT") direction = pacman::Direction::RIGHT;
+    else return false;
+    return true;
+}
+
+} // namespace
+
+OffscreenRenderer::OffscreenRenderer(OffscreenConfig config)
+    : config(std::move(config)) {
+}
+
+bool OffscreenRenderer::loadScript(const std::string& filename, std::vector<ScriptedInput>& inputs,
+                                   std::string& error) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        error = "cannot open " + filename;
+        return false;
+    }
+
+    inputs.clear();
+    std::string line;
+    int lineNumber = 0;
+    while (std::getline(file, line)) {
+        ++lineNumber;
+        auto comment = line.find('#');
+        if (comment != std::string::npos) line.erase(comment);
+
+        std::istringstream stream(line);
+        ScriptedInput input;
+        std::string name;
+        if (!(stream >> input.frame)) continue;  // Lege lijn
+
+        if (!(stream >> name) || !parseDirection(name, input.direction)) {
+            error = filename + ":" + std::to_string(lineNumber) + ": expected '<frame> UP|DOWN|LEFT|RIGHT'";
+            return false;
+        }
+        if (!inputs.empty() && input.frame < inputs.back().frame) {
+            error = filename + ":" + std::to_string(lineNumber) + ": frames must be ascending";
+            return false;
+        }
+        inputs.push_back(input);
+    }
+    return true;
+}
+
+bool OffscreenRenderer::canUseGL() const {
+    if (config.forceNullTarget) return false;
+#if defined(__linux__)
+    // SFML 2.5 (GLX) aborteert zonder X display
+    const char* display = std::getenv("DISPLAY");
+    return display != nullptr && display[0] != '\0';
+#else
+    return true;
+#endif
+}
+
+int OffscreenRenderer::run() {
+    std::vector<ScriptedInput> script;
+    if (!config.scriptFile.empty()) {
+        std::string error;
+        if (!loadScript(config.scriptFile, script, error)) {
+            std::cerr << "Offscreen: " << error << std::endl;
+            return 1;
+        }
+    }
+
+    // Backend kiezen vóór er iets een GL context nodig heeft (textures, fonts)
+    std::unique_ptr<sf::RenderTexture> renderTexture;
+    std::unique_ptr<NullRenderTarget> nullTarget;
+    if (canUseGL()) {
+        renderTexture = std::make_unique<sf::RenderTexture>();
+        if (!renderTexture->create(WIDTH, HEIGHT)) {
+            std::cerr << "Offscreen: RenderTexture creation failed, using null target" << std::endl;
+            renderTexture.reset();
+        }
+    }
+    if (!renderTexture) {
+        nullTarget = std::make_unique<NullRenderTarget>(WIDTH, HEIGHT);
+    }
+    sf::RenderTarget& target = renderTexture ? static_cast<sf::RenderTarget&>(*renderTexture)
+                                             : static_cast<sf::RenderTarget&>(*nullTarget);
+
+    bool dumping = !config.dumpDirectory.empty() && config.dumpEvery > 0;
+    if (dumping && !renderTexture) {
+        std::cerr << "Offscreen: no GL context, --dump-frames ignored" << std::endl;
+        dumping = false;
+    }
+    if (dumping) {
+        std::error_code error;
+        std::filesystem::create_directories(config.dumpDirectory, error);
+        if (error) {
+            std::cerr << "Offscreen: cannot create " << config.dumpDirectory << ": " << error.message() << std::endl;
+            return 1;
+        }
+    }
+
+    auto& spriteManager = SpriteManager::getInstance();
+    try {
+        if (renderTexture) {
+            spriteManager.loadSpriteSheet("../resources/sprites/sprite.png");
+        }
+        spriteManager.initialize();
+    } catch (const std::exception& e) {
+        std::cerr << "Offscreen: " << e.what() << std::endl;
+        return 1;
+    }
+
+    std::ofstream timings(config.timingsFile);
+    if (!timings.is_open()) {
+        std::cerr << "Offscreen: cannot write " << config.timingsFile << std::endl;
+        return 1;
+    }
+    timings << "frame,update_us,render_us,readback_us\n";
+
+    pacman::Random::getInstance().seed(config.seed);
+
+    auto& frameStats = pacman::FrameStats::getInstance();
+    frameStats.reset();
+    frameStats.setTargetFrameTime(config.deltaTime);
+
+    LevelState level(config.level);
+    level.setOffscreen(renderTexture != nullptr);
+    level.onEnter();
+
+    std::size_t nextInput = 0;
+    pacman::Direction heldDirection = pacman::Direction::NONE;
+    int frame = 0;
+    for (; frame < config.frames && !level.isFinished(); ++frame) {
+        // Script: toets ingedrukt houden vanaf zijn frame
+        while (nextInput < script.size() && script[nextInput].frame <= frame) {
+            heldDirection = script[nextInput++].direction;
+        }
+
+        auto frameStart = Clock::now();
+        level.applyDirection(heldDirection);
+        level.update(config.deltaTime);
+
+        auto renderStart = Clock::now();
+        level.renderTo(target);
+        if (renderTexture) {
+            renderTexture->display();
+        }
+
+        auto readbackStart = Clock::now();
+        if (dumping && frame % config.dumpEvery == 0) {
+            std::ostringstream path;
+            path << config.dumpDirectory << "/frame_" << std::setfill('0') << std::setw(5) << frame << ".png";
+            if (!renderTexture->getTexture().copyToImage().saveToFile(path.str())) {
+                std::cerr << "Offscreen: cannot write " << path.str() << std::endl;
+                return 1;
+            }
+        }
+        auto frameEnd = Clock::now();
+
+        pacman::FrameSample sample;
+        sample.updateUs = toMicroseconds(renderStart - frameStart);
+        sample.renderUs = toMicroseconds(readbackStart - renderStart);
+        sample.presentUs = toMicroseconds(frameEnd - readbackStart);
+        sample.frameUs = toMicroseconds(frameEnd - frameStart);
+        frameStats.record(sample);
+
+        timings << frame << ',' << sample.updateUs << ',' << sample.renderUs << ',' << sample.presentUs << '\n';
+    }
+
+    level.onExit();
+    frameStats.writeSummary(config.summaryFile);
+
+    std::cout << "Offscreen: " << frame << " frames, backend "
+              << (renderTexture ? "RenderTexture" : "null (no GL context)") << "\n"
+              << frameStats.getOverlayText() << std::endl;
+
+    if (config.renderBudgetMs > 0.0f) {
+        double p99Ms = static_cast<double>(frameStats.getRenderHistogram().valueAtPercentile(99.0)) / 1000.0;
+        if (p99Ms > config.renderBudgetMs) {
+            std::cerr << "Offscreen: render p99 " << p99Ms << " ms exceeds budget "
+                      << config.renderBudgetMs << " ms" << std::endl;
+            return 2;
+        }
+    }
+    return 0;
+}
+
+} // namespace pacman::representation
@@ -0,0 +1,290 @@
+#include "representation/SnapshotRenderer.h"
+#include "representation/SpriteManager.h"
+#include "representation/views/SpriteNames.h"
+#include "logic/entities/Ghost.h"
+#include "logic/utils/Profiler.h"
+#include <algorithm>
+#include <iostream>
+
+namespace pacman::representation {
+
+namespace {
+
+void playAnimation(AnimationController& controller, const std::string& name) {
+    auto& spriteManager = SpriteManager::getInstance();
+    try {
+        if (spriteManager.hasAnimation(name)) {
+            controller.play(spriteManager.getAnimation(name));
+        } else {
+            std::cerr << "SnapshotRenderer: Animation not found: " << name << std::endl;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "SnapshotRenderer: Error playing animation: " << e.what() << std::endl;
+    }
+}
+
+} // namespace
+
+SnapshotRenderer::SnapshotRenderer(const pacman::World& world, std::weak_ptr<pacman::Camera> camera) {
+
+    const auto& components = world.getComponents();
+    coinPositions.reserve(components.coins.size());
+    for (const auto& transform : components.coins.transforms) {
+        coinPositions.push_back(transform.position);
+    }
+    fruitPositions.reserve(components.fruits.size());
+    for (const auto& transform : components.fruits.transforms) {
+        fruitPositions.push_back(transform.position);
+    }
+    hasDoor = world.hasDoorInMap();
+    doorPosition = world.getDoorPosition();
+
+    auto cam = camera.lock();
+    float size = cam ? cam->getSpriteSize() : 0.0f;
+
+    if (cam) {
+        tileSize = cam->getTileWorldSize();
+        visibilityIndex.setGrid(-cam->getWorldWidth(), -cam->getWorldHeight(), cam->getTileWorldSize(),
+                                cam->getMapCols(), cam->getMapRows());
+        std::uint32_t id = 0;
+        for (const auto* positions : {&coinPositions, &fruitPositions}) {
+            for (const auto& position : *positions) {
+                visibilityIndex.insert(id++, tileBounds(position));
+            }
+        }
+        visibilityIndex.build();
+    }
+
+    // Zelfde vormen als WallView, DoorView en CoinView
+    float sizeWithOverlap = size + 1.0f;
+
+    // Walls: één quad per wall in world units (pixel maat / scale bij constructie)
+    float scale = cam ? cam->getTransform().scale : 1.0f;
+    float halfWall = sizeWithOverlap / scale / 2.0f;
+    wallVertices.setPrimitiveType(sf::Quads);
+    wallVertices.resize(components.wallTransforms.size() * 4);
+    std::size_t vertex = 0;
+    for (const auto& transform : components.wallTransforms) {
+        const auto& p = transform.position;
+        wallVertices[vertex++] = sf::Vertex(sf::Vector2f(p.x - halfWall, p.y - halfWall), sf::Color::Blue);
+        wallVertices[vertex++] = sf::Vertex(sf::Vector2f(p.x + halfWall, p.y - halfWall), sf::Color::Blue);
+        wallVertices[vertex++] = sf::Vertex(sf::Vector2f(p.x + halfWall, p.y + halfWall), sf::Color::Blue);
+        wallVertices[vertex++] = sf::Vertex(sf::Vector2f(p.x - halfWall, p.y + halfWall), sf::Color::Blue);
+    }
+
+    doorShape.setSize(sf::Vector2f(sizeWithOverlap, sizeWithOverlap));
+    doorShape.setFillColor(sf::Color(139, 69, 19));
+    doorShape.setOrigin(sizeWithOverlap / 2.0f, sizeWithOverlap / 2.0f);
+
+    float coinRadius = size * 0.15f;
+    coinShape.setRadius(coinRadius);
+    coinShape.setFillColor(sf::Color::Yellow);
+    coinShape.setOrigin(coinRadius, coinRadius);
+
+    auto& spriteManager = SpriteManager::getInstance();
+    fruitSprite.setTexture(spriteManager.getTexture());
+    applySpriteRect(fruitSprite, "fruit");
+
+    pacmanSprite.sprite.setTexture(spriteManager.getTexture());
+    playAnimation(pacmanSprite.animationController, "pacman_walk_right");
+    applySpriteRect(pacmanSprite.sprite, pacmanSprite.animationController.getCurrentSpriteName());
+    pacmanSprite.appliedFrameVersion = pacmanSprite.animationController.getFrameVersion();
+    if (const auto* model = world.getPacMan()) {
+        pacmanSprite.lastLives = model->getLives();
+    }
+
+    ghostSprites.resize(world.getGhosts().size());
+    for (std::size_t i = 0; i < ghostSprites.size(); ++i) {
+        const auto& model = *world.getGhosts()[i];
+        auto& ghost = ghostSprites[i];
+        ghost.sprite.setTexture(spriteManager.getTexture());
+        ghost.color = model.getColor();
+        ghost.lastDirection = model.getCurrentDirection();
+        ghost.lastState = model.getState();
+
+        pacman::RenderSnapshot::GhostSnapshot state;
+        state.direction = ghost.lastDirection;
+        state.state = ghost.lastState;
+        playGhostAnimation(ghost, state);
+        applySpriteRect(ghost.sprite, ghost.animationController.getCurrentSpriteName());
+        ghost.appliedFrameVersion = ghost.animationController.getFrameVersion();
+    }
+}
+
+void SnapshotRenderer::update(const pacman::RenderSnapshot& snapshot, float deltaTime) {
+    PACMAN_PROFILE_SCOPE("SnapshotRenderer::update");
+
+    updatePacMan(snapshot);
+
+    // READY: World krijgt update(0); tijdens de death animation updatet de World geen ghosts
+    bool ghostsFrozen = snapshot.showingReady || snapshot.deathAnimationPlaying;
+    std::size_t count = std::min(ghostSprites.size(), snapshot.ghosts.size());
+    for (std::size_t i = 0; i < count; ++i) {
+        updateGhost(ghostSprites[i], snapshot.ghosts[i], deltaTime, ghostsFrozen);
+    }
+}
+
+void SnapshotRenderer::updatePacMan(const pacman::RenderSnapshot& snapshot) {
+    if (!snapshot.hasPacMan) return;
+
+    // Leven verloren = PACMAN_DIED in de single-threaded Views
+    if (snapshot.lives < pacmanSprite.lastLives) {
+        pacmanSprite.playingDeathAnimation = true;
+        playAnimation(pacmanSprite.animationController, "pacman_death");
+    }
+    pacmanSprite.lastLives = snapshot.lives;
+
+    if (!pacmanSprite.playingDeathAnimation) {
+        if (snapshot.pacmanDirection != pacmanSprite.lastDirection && snapshot.pacmanDirection != pacman::Direction::NONE) {
+            if (const char* name = sprites::pacmanWalkAnimation(snapshot.pacmanDirection)) {
+                playAnimation(pacmanSprite.animationController, name);
+            }
+            pacmanSprite.lastDirection = snapshot.pacmanDirection;
+        }
+        pacmanSprite.animationController.update();
+    } else {
+        pacmanSprite.animationController.update();
+        if (pacmanSprite.animationController.isFinished()) {
+            pacmanSprite.playingDeathAnimation = false;
+            playAnimation(pacmanSprite.animationController, "pacman_walk_right");
+        }
+    }
+
+    // Enkel bij een nieuwe frame of animatie
+    std::uint32_t frameVersion = pacmanSprite.animationController.getFrameVersion();
+    if (frameVersion != pacmanSprite.appliedFrameVersion) {
+        pacmanSprite.appliedFrameVersion = frameVersion;
+        applySpriteRect(pacmanSprite.sprite, pacmanSprite.animationController.getCurrentSpriteName());
+    }
+}
+
+void SnapshotRenderer::updateGhost(GhostSprite& ghost, const pacman::RenderSnapshot::GhostSnapshot& state,
+                                   float deltaTime, bool frozen) {
+    // Opnieuw scared (nieuw fruit) = GHOST_STATE_CHANGED: flicker reset
+    bool scaredRenewed = state.state == pacman::GhostState::SCARED &&
+                         state.scaredTimeRemaining > ghost.lastScaredTimeRemaining;
+
+    if (state.direction != ghost.lastDirection || state.state != ghost.lastState || scaredRenewed) {
+        playGhostAnimation(ghost, state);
+        if (state.state != ghost.lastState || scaredRenewed) {
+            ghost.flickerTimer = 0.0f;
+            ghost.flickerState = false;
+        }
+        ghost.lastDirection = state.direction;
+        ghost.lastState = state.state;
+    }
+    ghost.lastScaredTimeRemaining = state.scaredTimeRemaining;
+
+    if (state.state == pacman::GhostState::SCARED) {
+        if (!frozen) {
+            ghost.flickerTimer += deltaTime;
+        }
+        if (ghost.flickerTimer >= sprites::flickerInterval(state.scaredTimeRemaining)) {
+            ghost.flickerTimer = 0.0f;
+            ghost.flickerState = !ghost.flickerState;
+        }
+        int scaredFrame = ghost.flickerState ? 1 : 0;
+        if (scaredFrame != ghost.appliedScaredFrame) {
+            ghost.appliedScaredFrame = scaredFrame;
+            ghost.appliedFrameVersion = 0;
+            applySpriteRect(ghost.sprite, sprites::SCARED_SPRITES[scaredFrame]);
+        }
+    } else {
+        // Gedeelde klok loopt door tijdens de death animation: sprite bevriezen zoals GhostView
+        if (!frozen) {
+            ghost.animationController.update();
+        }
+        std::uint32_t frameVersion = ghost.animationController.getFrameVersion();
+        if (frameVersion != ghost.appliedFrameVersion) {
+            ghost.appliedFrameVersion = frameVersion;
+            ghost.appliedScaredFrame = -1;
+            applySpriteRect(ghost.sprite, ghost.animationController.getCurrentSpriteName());
+        }
+    }
+}
+
+void SnapshotRenderer::playGhostAnimation(GhostSprite& ghost, const pacman::RenderSnapshot::GhostSnapshot& state) {
+    // Scared heeft voorrang boven kleur
+    if (state.state == pacman::GhostState::SCARED) {
+        playAnimation(ghost.animationController, sprites::GHOST_SCARED_ANIMATION);
+        return;
+    }
+
+    playAnimation(ghost.animationController, sprites::ghostWalkAnimation(ghost.color, state.direction));
+}
+
+void SnapshotRenderer::applySpriteRect(sf::Sprite& sprite, const std::string& spriteName) const {
+    if (spriteName.empty()) return;
+
+    auto& spriteManager = SpriteManager::getInstance();
+    if (!spriteManager.hasSpriteRect(spriteName)) return;
+
+    sf::IntRect rect = spriteManager.getSpriteRect(spriteName);
+    sprite.setTextureRect(rect);
+    sprite.setOrigin(rect.width / 2.0f, rect.height / 2.0f);
+}
+
+void SnapshotRenderer::placeSprite(sf::Sprite& sprite, const pacman::Position& position,
+                                   const FrameTransform& frame) const {
+    sprite.setPosition(frame.toScreen(position));
+    sprite.setScale(frame.spriteScale(sprite.getTextureRect()));
+}
+
+pacman::BoundingBox SnapshotRenderer::tileBounds(const pacman::Position& position) const {
+    return pacman::BoundingBox(position.x - tileSize / 2.0f, position.y - tileSize / 2.0f, tileSize, tileSize);
+}
+
+void SnapshotRenderer::draw(sf::RenderTarget& target, const pacman::RenderSnapshot& snapshot,
+                            const FrameTransform& frame) {
+    PACMAN_PROFILE_SCOPE("SnapshotRenderer::draw");
+
+    pacman::BoundingBox area = frame.camera.visibleBounds();
+    visibilityIndex.query(area, visibleIds);
+
+    auto drawAt = [&](sf::Transformable& shape, const pacman::Position& position) {
+        shape.setPosition(frame.toScreen(position));
+    };
+
+    // Zelfde volgorde als de Views: map tiles, PacMan, ghosts, door (LevelState voegt DoorView als laatste toe)
+    // Walls: statisch in world units, enkel de transform volgt de camera (één draw call)
+    target.draw(wallVertices, sf::RenderStates(frame.worldTransform));
+
+    const std::size_t fruitStart = coinPositions.size();
+    for (std::uint32_t id : visibleIds) {
+        if (id < fruitStart) {
+            std::size_t coin = id;
+            if (coin < snapshot.coinsCollected.size() && !snapshot.coinsCollected[coin]) {
+                drawAt(coinShape, coinPositions[coin]);
+                target.draw(coinShape);
+            }
+        } else {
+            std::size_t fruit = id - fruitStart;
+            if (fruit < snapshot.fruitsCollected.size() && !snapshot.fruitsCollected[fruit]) {
+                placeSprite(fruitSprite, fruitPositions[fruit], frame);
+                target.draw(fruitSprite);
+            }
+        }
+    }
+
+    actorBatch.begin(target);
+    if (snapshot.hasPacMan && tileBounds(snapshot.pacmanPosition).intersects(area)) {
+        placeSprite(pacmanSprite.sprite, snapshot.pacmanPosition, frame);
+        actorBatch.add(pacmanSprite.sprite);
+    }
+
+    std::size_t ghostCount = std::min(ghostSprites.size(), snapshot.ghosts.size());
+    for (std::size_t i = 0; i < ghostCount; ++i) {
+        if (tileBounds(snapshot.ghosts[i].position).intersects(area)) {
+            placeSprite(ghostSprites[i].sprite, snapshot.ghosts[i].position, frame);
+            actorBatch.add(ghostSprites[i].sprite);
+        }
+    }
+    actorBatch.flush();
+
+    if (hasDoor && tileBounds(doorPosition).intersects(area)) {
+        drawAt(doorShape, doorPosition);
+        target.draw(doorShape);
+    }
+}
+
+} // namespace pacman::representation
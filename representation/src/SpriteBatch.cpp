@@ -0,0 +1,59 @@
+#include "representation/SpriteBatch.h"
+#include <cstdlib>
+
+namespace pacman::representation {
+
+SpriteBatch::SpriteBatch()
+    : vertices(sf::Triangles) {}
+
+void SpriteBatch::begin(sf::RenderTarget& renderTarget) {
+    vertices.clear();
+    texture = nullptr;
+    target = &renderTarget;
+    drawCalls = 0;
+}
+
+void SpriteBatch::add(const sf::Sprite& sprite) {
+    if (sprite.getTexture() != texture) {
+        flush();
+        texture = sprite.getTexture();
+    }
+
+    // Zelfde geometrie als sf::Sprite: lokale rechthoek (0,0)-(|w|,|h|) door de sprite transform
+    const sf::IntRect& rect = sprite.getTextureRect();
+    const sf::Transform& transform = sprite.getTransform();
+    const sf::Color& color = sprite.getColor();
+
+    float width = static_cast<float>(std::abs(rect.width));
+    float height = static_cast<float>(std::abs(rect.height));
+
+    float left = static_cast<float>(rect.left);
+    float right = left + static_cast<float>(rect.width);
+    float top = static_cast<float>(rect.top);
+    float bottom = top + static_cast<float>(rect.height);
+
+    sf::Vertex topLeft(transform.transformPoint(0.0f, 0.0f), color, sf::Vector2f(left, top));
+    sf::Vertex topRight(transform.transformPoint(width, 0.0f), color, sf::Vector2f(right, top));
+    sf::Vertex bottomRight(transform.transformPoint(width, height), color, sf::Vector2f(right, bottom));
+    sf::Vertex bottomLeft(transform.transformPoint(0.0f, height), color, sf::Vector2f(left, bottom));
+
+    vertices.append(topLeft);
+    vertices.append(topRight);
+    vertices.append(bottomRight);
+    vertices.append(topLeft);
+    vertices.append(bottomRight);
+    vertices.append(bottomLeft);
+}
+
+void SpriteBatch::flush() {
+    if (vertices.getVertexCount() == 0 || !target) return;
+
+    sf::RenderStates states;
+    states.texture = texture;
+    target->draw(vertices, states);
+    ++drawCalls;
+
+    vertices.clear();
+}
+
+} // namespace pacman::representation
@@ -8,6 +8,16 @@ SpriteManager::SpriteManager() {
     std::cout << "SpriteManager initialized" << std::endl;
 }
 
+void SpriteManager::loadSpriteSheet(const sf::Image& image) {
+    if (!spriteSheet.loadFromImage(image)) {
+        throw std::runtime_error("Failed to upload sprite sheet texture");
+    }
+
+    spriteSheet.setSmooth(false);
+
+    textureLoaded = true;
+}
+
 void SpriteManager::loadSpriteSheet(const std::string& path) {
     if (!spriteSheet.loadFromFile(path)) {
         throw std::runtime_error("Failed to load sprite sheet: " + path);
@@ -1,7 +1,11 @@
 #include "representation/states/LevelState.h"
+#include "representation/AssetLoader.h"
 #include "representation/states/PausedState.h"
 #include "representation/states/VictoryState.h"
+#include "logic/utils/FrameStats.h"
+#include "logic/utils/Profiler.h"
 #include "logic/utils/Stopwatch.h"
+#include "representation/AnimationSystem.h"
 #include "representation/views/DoorView.h"
 
 #include <iostream>
@@ -10,31 +14,62 @@
 
 namespace pacman::representation {
 
+bool LevelState::threadedSimulation = false;
+float LevelState::followCameraRows = 0.0f;
+std::string LevelState::mapOverride;
+
 LevelState::LevelState(int level, bool isTutorial, int startScore)
     : currentLevel(level), tutorialMode(isTutorial), carryScore(startScore) {
 }
 
 LevelState::~LevelState() {
+    simulation.reset();  //  Stop simulation thread (owns world until joined)
     factory.reset();  //  Destroy views FIRST (detach from models)
     world.reset();    //  Then destroy models
+    simulationFactory.reset();
+    arena.reset();    //  Release level memory in one shot
 }
 
 void LevelState::onEnter() {
 
     camera = std::make_shared<pacman::Camera>(1000, 600);
-    factory = std::make_shared<ConcreteFactory>(camera);
-    world = std::make_unique<pacman::World>(*factory, camera, currentLevel, carryScore);
+    arena = std::make_unique<pacman::LevelArena>();
+    if (threadedSimulation) {
+        // Views zouden op de simulation thread genotified worden: World zonder Views
+        simulationFactory = std::make_unique<pacman::HeadlessFactory>();
+        simulationFactory->setArena(arena.get());
+        world = std::make_unique<pacman::World>(*simulationFactory, camera, currentLevel, carryScore);
+        world->setEntityStorage(pacman::EntityStorage::COMPONENTS);
+    } else {
+        factory = std::make_shared<ConcreteFactory>(camera);
+        factory->setArena(arena.get());
+        world = std::make_unique<pacman::World>(*factory, camera, currentLevel, carryScore);
+    }
+
+    if (followCameraRows > 0.0f) {
+        // Vóór loadLevel: Views schalen hun sprites bij constructie
+        pacman::CameraFollowSettings followSettings;
+        followSettings.visibleRows = followCameraRows;
+        camera->setFollowSettings(followSettings);
+        camera->setMode(pacman::CameraMode::FOLLOW);
+    }
 
-    std::string mapFile;
-    if (tutorialMode) {
-        mapFile = "../resources/maps/map.txt";
+    if (!preparedMapData.empty()) {
+        world->loadLevelFromData(preparedMapData);  // Vooraf gelezen (StatePreparer)
+        preparedMapData.clear();
     } else {
-        mapFile = "../resources/maps/map_big.txt";
+        world->loadLevel(mapFileFor(tutorialMode));
     }
 
-    world->loadLevel(mapFile);
+    if (auto* pacman = world->getPacMan()) {
+        camera->snapTo(pacman->getPosition());
+    }
 
-    if (world->hasDoorInMap()) {
+    if (threadedSimulation) {
+        snapshotRenderer = std::make_unique<SnapshotRenderer>(*world, camera);
+        simulation = std::make_unique<pacman::SimulationThread>(
+            *world, pacman::SimulationThread::DEFAULT_TICK, READY_DURATION);
+    } else if (world->hasDoorInMap()) {
         auto doorView = std::make_unique<DoorView>(camera, world->getDoorPosition());
         factory->addView(std::move(doorView));
     }
@@ -47,8 +82,11 @@ void LevelState::onEnter() {
     readyText.setCharacterSize(72);
     readyText.setFillColor(sf::Color::Yellow);
 
-    sf::FloatRect bounds = readyText.getLocalBounds();
-    readyText.setOrigin(bounds.width / 2.0f, bounds.height / 2.0f);
+    if (textRendering) {
+        // Glyph textures: enkel met een GL context (zie setOffscreen)
+        sf::FloatRect bounds = readyText.getLocalBounds();
+        readyText.setOrigin(bounds.width / 2.0f, bounds.height / 2.0f);
+    }
 
     float viewportCenterX = camera->getViewportOffsetX() + camera->getViewportWidth() / 2.0f;
     float viewportCenterY = camera->getViewportOffsetY() + camera->getViewportHeight() / 2.0f;
@@ -58,10 +96,34 @@ void LevelState::onEnter() {
     showingReady = true;
     readyTimer = 0.0f;
     wasPlayingDeathAnimation = false;
+
+    if (simulation) {
+        simulation->start();  // Vanaf hier is world van de simulation thread
+        snapshot = &simulation->acquireSnapshot();
+    }
+}
+
+std::string LevelState::mapFileFor(bool tutorial) {
+    if (!mapOverride.empty()) {
+        return mapOverride;
+    }
+    return tutorial ? "../resources/maps/map.txt" : "../resources/maps/map_big.txt";
+}
+
+PreparationRequest LevelState::getPreparationRequest() const {
+    PreparationRequest request;
+    request.mapFile = mapFileFor(false);
+    return request;
+}
+
+void LevelState::adoptPrepared(const PreparedResources& prepared) {
+    if (prepared.mapFile == mapFileFor(tutorialMode)) {
+        preparedMapData = prepared.mapData;
+    }
 }
 
 void LevelState::loadFont() {
-    if (!font.loadFromFile("../resources/fonts/Retro.ttf")) {
+    if (!AssetLoader::getInstance().copyFont(font)) {
         std::cerr << "Warning: Could not load font" << std::endl;
     }
 }
@@ -128,14 +190,14 @@ void LevelState::setupUI() {
     controlsTitle.setPosition(rightSidebarX, 240);
 
     controlKeysText.setFont(font);
-    controlKeysText.setString("Arrows\nESC");
+    controlKeysText.setString("Arrows\nESC\nF3");
     controlKeysText.setCharacterSize(18);
     controlKeysText.setFillColor(sf::Color(180, 180, 180));
     controlKeysText.setLineSpacing(1.6f);
     controlKeysText.setPosition(rightSidebarX, 275);
 
     controlActionsText.setFont(font);
-    controlActionsText.setString("Move\nPause");
+    controlActionsText.setString("Move\nPause\nStats");
     controlActionsText.setCharacterSize(18);
     controlActionsText.setFillColor(sf::Color::White);
     controlActionsText.setLineSpacing(1.6f);
@@ -160,6 +222,14 @@ void LevelState::setupUI() {
     pointsValuesText.setFillColor(sf::Color::White);
     pointsValuesText.setLineSpacing(1.6f);
     pointsValuesText.setPosition(rightSidebarX + 100, 435);
+
+    frameStatsText.setFont(font);
+    frameStatsText.setCharacterSize(12);
+    frameStatsText.setFillColor(sf::Color::Green);
+    frameStatsText.setPosition(cam->getViewportOffsetX() + 8, cam->getViewportOffsetY() + 8);
+
+    frameStatsBackground.setFillColor(sf::Color(0, 0, 0, 180));
+    frameStatsBackground.setPosition(cam->getViewportOffsetX(), cam->getViewportOffsetY());
 }
 
 void LevelState::onExit() {
@@ -169,7 +239,14 @@ void LevelState::onExit() {
 void LevelState::handleInput(const sf::Event& event, sf::RenderWindow& window) {
     if (event.type == sf::Event::KeyPressed) {
         if (event.key.code == sf::Keyboard::Escape) {
+            if (simulation) {
+                // LevelState::update() loopt niet tijdens PausedState: ook de simulation stilzetten
+                simulationPaused = simulation->pushCommand({pacman::SimulationCommand::Type::PAUSE});
+            }
             finish(StateAction::PUSH, std::make_unique<PausedState>());
+        } else if (event.key.code == sf::Keyboard::F3) {
+            showFrameStats = !showFrameStats;
+            frameStatsRefreshTimer = FRAME_STATS_REFRESH;  // Direct verversen
         }
     }
 
@@ -179,53 +256,115 @@ void LevelState::handleInput(const sf::Event& event, sf::RenderWindow& window) {
 }
 
 void LevelState::handlePlayerInput() {
-    auto* pacman = world->getPacMan();
-    if (!pacman) return;
+    pacman::Direction direction = pacman::Direction::NONE;
 
     if (sf::Keyboard::isKeyPressed(sf::Keyboard::Up)) {
-        pacman->setDirection(pacman::Direction::UP);
+        direction = pacman::Direction::UP;
     } else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Down)) {
-        pacman->setDirection(pacman::Direction::DOWN);
+        direction = pacman::Direction::DOWN;
     } else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Left)) {
-        pacman->setDirection(pacman::Direction::LEFT);
+        direction = pacman::Direction::LEFT;
     } else if (sf::Keyboard::isKeyPressed(sf::Keyboard::Right)) {
-        pacman->setDirection(pacman::Direction::RIGHT);
+        direction = pacman::Direction::RIGHT;
     }
+
+    applyDirection(direction);
 }
 
-void LevelState::update(float deltaTime) {
-    bool isDeathAnimPlaying = world->isPlayingDeathAnimation();
+void LevelState::applyDirection(pacman::Direction direction) {
+    if (direction == pacman::Direction::NONE || showingReady) return;
 
-    if (wasPlayingDeathAnimation && !isDeathAnimPlaying) {
-        showingReady = true;
-        readyTimer = 0.0f;
+    if (simulation) {
+        simulation->pushCommand({pacman::SimulationCommand::Type::SET_DIRECTION, direction});
+        return;
     }
 
-    wasPlayingDeathAnimation = isDeathAnimPlaying;
+    if (auto* pacman = world->getPacMan()) {
+        pacman->setDirection(direction);
+    }
+}
 
-    if (showingReady) {
-        readyTimer += deltaTime;
-        if (readyTimer >= READY_DURATION) {
-            showingReady = false;
+void LevelState::update(float deltaTime) {
+    if (simulation) {
+        updateFromSimulation(deltaTime);
+    } else {
+        // Camera vóór de World: Views zetten hun sprites in onNotify met deze camera
+        if (auto* pacman = world->getPacMan()) {
+            camera->update(pacman->getPosition(), deltaTime);
         }
+
+        bool isDeathAnimPlaying = world->isPlayingDeathAnimation();
+
+        if (wasPlayingDeathAnimation && !isDeathAnimPlaying) {
+            showingReady = true;
+            readyTimer = 0.0f;
+        }
+
+        wasPlayingDeathAnimation = isDeathAnimPlaying;
+
+        if (showingReady) {
+            readyTimer += deltaTime;
+            if (readyTimer >= READY_DURATION) {
+                showingReady = false;
+            }
+        }
+        else {
+            elapsedTime += deltaTime;
+        }
+        // Gedeelde animatie klokken: zelfde tijd als de World (stil tijdens READY)
+        AnimationSystem::getInstance().advance(showingReady ? 0.0f : deltaTime);
+        world->update(showingReady ? 0.0f : deltaTime);
     }
-    else {
-        elapsedTime += deltaTime;
-    }
-    world->update(showingReady ? 0.0f : deltaTime);
     updateUI();
+
+    if (showFrameStats) {
+        frameStatsRefreshTimer += deltaTime;
+        if (frameStatsRefreshTimer >= FRAME_STATS_REFRESH) {
+            frameStatsRefreshTimer = 0.0f;
+            updateFrameStatsOverlay();
+        }
+    }
+
     checkGameState();
 }
 
-void LevelState::updateUI() {
-    auto& score = world->getScore();
-    auto* pacman = world->getPacMan();
+void LevelState::updateFromSimulation(float deltaTime) {
+    if (simulationPaused) {
+        simulationPaused = !simulation->pushCommand({pacman::SimulationCommand::Type::RESUME});
+    }
 
-    scoreText.setString(std::to_string(score.getCurrentScore()));
+    snapshot = &simulation->acquireSnapshot();
+    showingReady = snapshot->showingReady;
+    elapsedTime = snapshot->elapsedTime;
 
-    if (pacman) {
-        livesText.setString(std::to_string(pacman->getLives()));
+    if (snapshot->hasPacMan) {
+        camera->update(snapshot->pacmanPosition, deltaTime);
     }
+    AnimationSystem::getInstance().advance(showingReady ? 0.0f : deltaTime);
+    snapshotRenderer->update(*snapshot, deltaTime);
+}
+
+int LevelState::getCurrentScore() const {
+    return snapshot ? snapshot->score : world->getScore().getCurrentScore();
+}
+
+int LevelState::getCurrentLives() const {
+    if (snapshot) return snapshot->lives;
+
+    auto* pacman = world->getPacMan();
+    return pacman ? pacman->getLives() : 0;
+}
+
+void LevelState::updateFrameStatsOverlay() {
+    frameStatsText.setString(pacman::FrameStats::getInstance().getOverlayText());
+
+    sf::FloatRect bounds = frameStatsText.getLocalBounds();
+    frameStatsBackground.setSize(sf::Vector2f(bounds.width + 16, bounds.height + 16));
+}
+
+void LevelState::updateUI() {
+    scoreText.setString(std::to_string(getCurrentScore()));
+    livesText.setString(std::to_string(getCurrentLives()));
 
     levelText.setString(std::to_string(currentLevel));
 
@@ -238,12 +377,18 @@ void LevelState::updateUI() {
 }
 
 void LevelState::checkGameState() {
-    if (world->isGameOver()) {
-        int finalScore = world->getScore().getCurrentScore();
+    bool gameOver = snapshot ? snapshot->gameOver : world->isGameOver();
+    bool levelComplete = snapshot ? snapshot->levelComplete : world->isLevelComplete();
+
+    if (offscreen && (gameOver || levelComplete)) {
+        // Offscreen run: geen VictoryState, de driver stopt bij isFinished()
+        finish(StateAction::POP);
+    } else if (gameOver) {
+        int finalScore = getCurrentScore();
         finish(StateAction::SWITCH,
                std::make_unique<VictoryState>(false, finalScore, currentLevel));
-    } else if (world->isLevelComplete()) {
-        int finalScore = world->getScore().getCurrentScore();  // ← krijg score VOOR world destroy
+    } else if (levelComplete) {
+        int finalScore = getCurrentScore();  // ← krijg score VOOR world destroy
 
         if (tutorialMode) {
             finish(StateAction::SWITCH,
@@ -255,45 +400,98 @@ void LevelState::checkGameState() {
     }
 }
 
+void LevelState::maskOutsideViewport(sf::RenderTarget& target) {
+    auto cam = camera.get();
+    float left = cam->getViewportOffsetX();
+    float top = cam->getViewportOffsetY();
+    float right = left + cam->getViewportWidth();
+    float bottom = top + cam->getViewportHeight();
+    auto windowWidth = static_cast<float>(cam->getWindowWidth());
+    auto windowHeight = static_cast<float>(cam->getWindowHeight());
+
+    sf::RectangleShape mask;
+    mask.setFillColor(sf::Color(15, 15, 15));  // Zelfde als target.clear()
+
+    auto drawMask = [&](float x, float y, float width, float height) {
+        if (width <= 0.0f || height <= 0.0f) return;
+        mask.setPosition(x, y);
+        mask.setSize(sf::Vector2f(width, height));
+        target.draw(mask);
+    };
+    drawMask(0, 0, windowWidth, top);
+    drawMask(0, bottom, windowWidth, windowHeight - bottom);
+    drawMask(0, top, left, bottom - top);
+    drawMask(right, top, windowWidth - right, bottom - top);
+}
+
 void LevelState::render(sf::RenderWindow& window) {
-    window.clear(sf::Color(15, 15, 15));
+    renderTo(window);
+}
+
+void LevelState::renderTo(sf::RenderTarget& target) {
+    PACMAN_PROFILE_SCOPE("LevelState::render");
+
+    target.clear(sf::Color(15, 15, 15));
 
     auto cam = camera.get();  // Direct access to shared_ptr
 
+    // Eén projectie per frame, alle Views (en de SnapshotRenderer) delen ze
+    const FrameTransform frame = FrameTransform::from(*cam);
+
+    // World eerst: in follow mode steken sprites aan de rand buiten de viewport,
+    // de UI en het masker hieronder tekenen daar overheen
+    if (snapshotRenderer) {
+        snapshotRenderer->draw(target, *snapshot, frame);
+    } else {
+        factory->collectVisibleViews(frame, visibleViews);
+        spriteBatch.begin(target);
+        for (auto* view : visibleViews) {
+            if (!view->drawBatched(spriteBatch, frame)) {
+                spriteBatch.flush();  // Alles wat vóór deze View kwam blijft eronder
+                view->draw(target, frame);
+            }
+        }
+        spriteBatch.flush();
+    }
+
+    if (cam->getMode() == pacman::CameraMode::FOLLOW) {
+        maskOutsideViewport(target);
+    }
+
     if (hasLetterboxing) {
         sf::RectangleShape leftBg;
         leftBg.setSize(sf::Vector2f(cam->getViewportOffsetX(), cam->getWindowHeight()));
         leftBg.setFillColor(sf::Color(20, 20, 30));
         leftBg.setPosition(0, 0);
-        window.draw(leftBg);
+        target.draw(leftBg);
 
         sf::RectangleShape rightBg;
         rightBg.setSize(sf::Vector2f(cam->getViewportOffsetX(), cam->getWindowHeight()));
         rightBg.setFillColor(sf::Color(20, 20, 30));
         rightBg.setPosition(cam->getViewportOffsetX() + cam->getViewportWidth(), 0);
-        window.draw(rightBg);
+        target.draw(rightBg);
 
         sf::RectangleShape leftLine(sf::Vector2f(3, cam->getWindowHeight()));
         leftLine.setFillColor(sf::Color(255, 215, 0));
         leftLine.setPosition(cam->getViewportOffsetX() - 3, 0);
-        window.draw(leftLine);
+        target.draw(leftLine);
 
         sf::RectangleShape rightLine(sf::Vector2f(3, cam->getWindowHeight()));
         rightLine.setFillColor(sf::Color(255, 215, 0));
         rightLine.setPosition(cam->getViewportOffsetX() + cam->getViewportWidth(), 0);
-        window.draw(rightLine);
+        target.draw(rightLine);
 
         float dividerWidth = cam->getViewportOffsetX() - 40;
         if (dividerWidth > 0) {
             sf::RectangleShape divider1(sf::Vector2f(dividerWidth, 2));
             divider1.setFillColor(sf::Color(80, 80, 90));
             divider1.setPosition(20, 220);
-            window.draw(divider1);
+            target.draw(divider1);
 
             sf::RectangleShape divider2(sf::Vector2f(dividerWidth, 2));
             divider2.setFillColor(sf::Color(80, 80, 90));
             divider2.setPosition(20, 340);
-            window.draw(divider2);
+            target.draw(divider2);
         }
 
         float rightDividerX = cam->getViewportOffsetX() + cam->getViewportWidth() + 20;
@@ -301,46 +499,46 @@ void LevelState::render(sf::RenderWindow& window) {
             sf::RectangleShape divider3(sf::Vector2f(dividerWidth, 2));
             divider3.setFillColor(sf::Color(80, 80, 90));
             divider3.setPosition(rightDividerX, 230);
-            window.draw(divider3);
+            target.draw(divider3);
 
             sf::RectangleShape divider4(sf::Vector2f(dividerWidth, 2));
             divider4.setFillColor(sf::Color(80, 80, 90));
             divider4.setPosition(rightDividerX, 390);
-            window.draw(divider4);
+            target.draw(divider4);
         }
 
-        window.draw(scoreTitle);
-        window.draw(scoreText);
-        window.draw(livesTitle);
-        window.draw(livesText);
-        window.draw(levelTitle);
-        window.draw(levelText);
-
-        window.draw(timerTitle);
-        window.draw(timerText);
-        window.draw(controlsTitle);
-        window.draw(controlKeysText);
-        window.draw(controlActionsText);
-        window.draw(pointsTitle);
-        window.draw(pointsLabelsText);
-        window.draw(pointsValuesText);
+        drawText(target, scoreTitle);
+        drawText(target, scoreText);
+        drawText(target, livesTitle);
+        drawText(target, livesText);
+        drawText(target, levelTitle);
+        drawText(target, levelText);
+
+        drawText(target, timerTitle);
+        drawText(target, timerText);
+        drawText(target, controlsTitle);
+        drawText(target, controlKeysText);
+        drawText(target, controlActionsText);
+        drawText(target, pointsTitle);
+        drawText(target, pointsLabelsText);
+        drawText(target, pointsValuesText);
     }
     else {
         sf::Text compactScore;
         compactScore.setFont(font);
-        compactScore.setString("SCORE: " + std::to_string(world->getScore().getCurrentScore()));
+        compactScore.setString("SCORE: " + std::to_string(getCurrentScore()));
         compactScore.setCharacterSize(20);
         compactScore.setFillColor(sf::Color::Yellow);
         compactScore.setPosition(10, 10);
-        window.draw(compactScore);
+        drawText(target, compactScore);
 
         sf::Text compactLives;
         compactLives.setFont(font);
-        compactLives.setString("LIVES: " + std::to_string(world->getPacMan()->getLives()));
+        compactLives.setString("LIVES: " + std::to_string(getCurrentLives()));
         compactLives.setCharacterSize(20);
         compactLives.setFillColor(sf::Color::White);
         compactLives.setPosition(10, 40);
-        window.draw(compactLives);
+        drawText(target, compactLives);
 
         sf::Text compactLevel;
         compactLevel.setFont(font);
@@ -348,11 +546,7 @@ void LevelState::render(sf::RenderWindow& window) {
         compactLevel.setCharacterSize(20);
         compactLevel.setFillColor(sf::Color::White);
         compactLevel.setPosition(10, 70);
-        window.draw(compactLevel);
-    }
-
-    for (const auto& view : factory->getViews()) {
-        view->draw(window);
+        drawText(target, compactLevel);
     }
 
     if (showingReady) {
@@ -360,9 +554,20 @@ void LevelState::render(sf::RenderWindow& window) {
         overlay.setSize(sf::Vector2f(cam->getViewportWidth(), cam->getViewportHeight()));
         overlay.setFillColor(sf::Color(0, 0, 0, 150));
         overlay.setPosition(cam->getViewportOffsetX(), cam->getViewportOffsetY());
-        window.draw(overlay);
+        target.draw(overlay);
+
+        drawText(target, readyText);
+    }
+
+    if (showFrameStats) {
+        target.draw(frameStatsBackground);
+        drawText(target, frameStatsText);
+    }
+}
 
-        window.draw(readyText);
+void LevelState::drawText(sf::RenderTarget& target, const sf::Text& text) const {
+    if (textRendering) {
+        target.draw(text);
     }
 }
 
@@ -0,0 +1,68 @@
+#include "representation/states/LoadingState.h"
+#include "representation/states/MenuState.h"
+#include "representation/AssetLoader.h"
+#include <iostream>
+
+namespace pacman::representation {
+
+LoadingState::LoadingState() {
+    float centerX = 500.0f;  // Fixed 1000x600 layout
+
+    barBackground.setSize(sf::Vector2f(BAR_WIDTH, BAR_HEIGHT));
+    barBackground.setFillColor(sf::Color(40, 40, 50));
+    barBackground.setOutlineColor(sf::Color(255, 215, 0));
+    barBackground.setOutlineThickness(2.0f);
+    barBackground.setPosition(centerX - BAR_WIDTH / 2.0f, 320.0f);
+
+    barFill.setFillColor(sf::Color::Yellow);
+    barFill.setPosition(centerX - BAR_WIDTH / 2.0f, 320.0f);
+
+    coin.setRadius(8.0f);
+    coin.setOrigin(8.0f, 8.0f);
+}
+
+void LoadingState::onEnter() {
+    std::cout << "Entering LoadingState" << std::endl;
+    AssetLoader::getInstance().startLoading();
+}
+
+PreparationRequest LoadingState::getPreparationRequest() const {
+    PreparationRequest request;
+    request.highScores = true;
+    return request;
+}
+
+void LoadingState::onExit() {
+    std::cout << "Assets loaded" << std::endl;
+}
+
+void LoadingState::handleInput(const sf::Event& /*event*/, sf::RenderWindow& /*window*/) {
+    // Geen input tijdens het laden (Game handelt window close af)
+}
+
+void LoadingState::update(float deltaTime) {
+    elapsed += deltaTime;
+
+    // Upload op de main thread zodra de worker klaar is
+    if (AssetLoader::getInstance().finishLoading()) {
+        finish(StateAction::SWITCH, std::make_unique<MenuState>());
+    }
+}
+
+void LoadingState::render(sf::RenderWindow& window) {
+    window.clear(sf::Color(15, 15, 15));
+
+    float progress = AssetLoader::getInstance().getProgress();
+    barFill.setSize(sf::Vector2f(BAR_WIDTH * progress, BAR_HEIGHT));
+    window.draw(barBackground);
+    window.draw(barFill);
+
+    int litCoin = static_cast<int>(elapsed / COIN_INTERVAL) % 3;
+    for (int i = 0; i < 3; ++i) {
+        coin.setFillColor(i == litCoin ? sf::Color::Yellow : sf::Color(90, 90, 40));
+        coin.setPosition(470.0f + i * 30.0f, 280.0f);
+        window.draw(coin);
+    }
+}
+
+} // namespace pacman::representation
@@ -1,6 +1,8 @@
 // representation/src/states/MenuState.cpp
 #include "representation/states/MenuState.h"
+#include "representation/AssetLoader.h"
 #include "representation/states/LevelState.h"
+#include "logic/HighScoreService.h"
 #include <iostream>
 #include <representation/states/TutorialIntroState.h>
 
@@ -16,12 +18,18 @@ void MenuState::onEnter() {
     std::cout << "Entering MenuState" << std::endl;
 }
 
+PreparationRequest MenuState::getPreparationRequest() const {
+    PreparationRequest request;
+    request.mapFile = LevelState::mapFileFor(false);
+    return request;
+}
+
 void MenuState::onExit() {
     std::cout << "Exiting MenuState" << std::endl;
 }
 
 void MenuState::loadFont() {
-    if (!font.loadFromFile("../resources/fonts/Retro.ttf")) {
+    if (!AssetLoader::getInstance().copyFont(font)) {
         std::cerr << "Warning: Could not load font, using default" << std::endl;
     }
 }
@@ -73,8 +81,7 @@ void MenuState::setupTexts() {
 }
 
 void MenuState::loadHighScores() {
-    pacman::Score tempScore;
-    auto scores = tempScore.getHighScores();
+    auto scores = pacman::HighScoreService::getInstance().getHighScores();
 
     float centerX = 500.0f;
     float yPos = 450;
@@ -1,5 +1,6 @@
 // representation/src/states/PausedState.cpp
 #include "representation/states/PausedState.h"
+#include "representation/AssetLoader.h"
 #include "representation/states/MenuState.h"
 #include <iostream>
 
@@ -19,7 +20,7 @@ void PausedState::onExit() {
 }
 
 void PausedState::loadFont() {
-    if (!font.loadFromFile("../resources/fonts/Retro.ttf")) {
+    if (!AssetLoader::getInstance().copyFont(font)) {
         std::cerr << "Warning: Could not load font" << std::endl;
     }
 }
@@ -5,7 +5,11 @@ namespace pacman::representation {
 
 void StateManager::pushState(std::unique_ptr<State> state) {
     if (state) {
+        if (const auto* prepared = preparer.result()) {
+            state->adoptPrepared(*prepared);
+        }
         state->onEnter();
+        preparer.request(state->getPreparationRequest());
         states.push(std::move(state));
     }
 }
@@ -17,6 +21,12 @@ void StateManager::popState() {
     }
 }
 
+void StateManager::clear() {
+    while (!states.empty()) {
+        popState();
+    }
+}
+
 void StateManager::switchState(std::unique_ptr<State> state) {
     if (!states.empty()) {
         states.top()->onExit();
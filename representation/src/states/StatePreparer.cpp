@@ -0,0 +1,62 @@
+#include "representation/states/StatePreparer.h"
+#include "logic/HighScoreService.h"
+#include "logic/World.h"
+#include "logic/utils/Profiler.h"
+#include <exception>
+#include <iostream>
+
+namespace pacman::representation {
+
+StatePreparer::~StatePreparer() {
+    join();
+}
+
+void StatePreparer::join() {
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+void StatePreparer::request(const PreparationRequest& request) {
+    if (request.isEmpty()) return;  // Bv. PausedState: resultaat voor de level blijft
+
+    // Vorige worker nog bezig: niet wachten op de main thread, deze request vervalt
+    // (de volgende state laadt dan zelf synchroon)
+    if (hasResult && !isReady()) return;
+
+    join();
+    ready.store(false, std::memory_order_release);
+    hasResult = true;
+    worker = std::thread(&StatePreparer::prepare, this, request);
+}
+
+const PreparedResources* StatePreparer::result() {
+    // Nog niet klaar: geen join (zou de transitie blokkeren), state laadt synchroon
+    if (!hasResult || !isReady()) return nullptr;
+    join();  // Worker is klaar, enkel de thread opruimen
+    return &pending;
+}
+
+void StatePreparer::prepare(PreparationRequest request) {
+    PACMAN_PROFILE_SCOPE("StatePreparer::prepare");
+
+    pending = PreparedResources();
+    pending.mapFile = request.mapFile;
+
+    if (!request.mapFile.empty()) {
+        try {
+            pending.mapData = pacman::World::readMapFile(request.mapFile);
+        } catch (const std::exception& e) {
+            // Niet fataal: de LevelState probeert zelf en meldt de fout dan
+            std::cerr << "Warning: could not prepare map: " << e.what() << std::endl;
+        }
+    }
+
+    if (request.highScores) {
+        pacman::HighScoreService::getInstance().load();  // Eén disk read, daarna geheugen
+    }
+
+    ready.store(true, std::memory_order_release);
+}
+
+} // namespace pacman::representation
@@ -1,4 +1,5 @@
 #include "representation/states/TutorialIntroState.h"
+#include "representation/AssetLoader.h"
 #include "representation/states/LevelState.h"
 #include <iostream>
 
@@ -13,12 +14,18 @@ void TutorialIntroState::onEnter() {
     std::cout << "Entering Tutorial Intro" << std::endl;
 }
 
+PreparationRequest TutorialIntroState::getPreparationRequest() const {
+    PreparationRequest request;
+    request.mapFile = LevelState::mapFileFor(true);
+    return request;
+}
+
 void TutorialIntroState::onExit() {
     std::cout << "Starting Tutorial Level" << std::endl;
 }
 
 void TutorialIntroState::loadFont() {
-    if (!font.loadFromFile("../resources/fonts/Retro.ttf")) {
+    if (!AssetLoader::getInstance().copyFont(font)) {
         std::cerr << "Warning: Could not load font" << std::endl;
     }
 }
@@ -1,7 +1,8 @@
 #include "representation/states/VictoryState.h"
+#include "representation/AssetLoader.h"
 #include "representation/states/MenuState.h"
 #include "representation/states/LevelState.h"
-#include "logic/Score.h"
+#include "logic/HighScoreService.h"
 #include <iostream>
 
 namespace pacman::representation {
@@ -10,19 +11,16 @@ VictoryState::VictoryState(bool won, int finalScore, int currentLevel)
     : playerWon(won), score(finalScore), level(currentLevel),
       enteringName(false) {
 
-    // ✅ MAAK TIJDELIJK SCORE OBJECT VOOR HIGHSCORE CHECK
-    if (!won) {  // Alleen bij game over
-        pacman::Score tempScore;
-        isHighScore = tempScore.isHighScore(finalScore);
-    } else {
-        isHighScore = false;
-    }
-
     loadFont();
-    setupTexts();
 }
 
 void VictoryState::onEnter() {
+    if (!playerWon) {  // Alleen bij game over
+        isHighScore = pacman::HighScoreService::getInstance().isHighScore(score);
+    }
+
+    setupTexts();
+
     if (isHighScore) {
         enteringName = true;
     }
@@ -32,8 +30,14 @@ void VictoryState::onExit() {
     std::cout << "Leaving Victory/GameOver screen" << std::endl;
 }
 
+PreparationRequest VictoryState::getPreparationRequest() const {
+    PreparationRequest request;
+    request.mapFile = LevelState::mapFileFor(false);
+    return request;
+}
+
 void VictoryState::loadFont() {
-    if (!font.loadFromFile("../resources/fonts/Retro.ttf")) {
+    if (!AssetLoader::getInstance().copyFont(font)) {
         std::cerr << "Warning: Could not load font" << std::endl;
     }
 }
@@ -170,9 +174,8 @@ void VictoryState::handleInput(const sf::Event& event, sf::RenderWindow& window)
 }
 
 void VictoryState::saveHighScore() {
-    // MAAK NIEUW SCORE OBJECT OM TE SAVEN
-    pacman::Score scoreManager;
-    scoreManager.saveHighScore(playerName, score);
+    // Tabel in geheugen meteen aangepast (menu toont hem), disk write op de achtergrond
+    pacman::HighScoreService::getInstance().submit(playerName, score);
 }
 
 void VictoryState::update(float deltaTime) {
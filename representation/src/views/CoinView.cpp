@@ -3,8 +3,9 @@
 
 namespace pacman::representation {
 
-CoinView::CoinView(pacman::Coin& model, std::weak_ptr<pacman::Camera> camera)  // & niet *
-    : EntityView(model, camera), coinModel(model) {
+CoinView::CoinView(pacman::Coin& model, std::shared_ptr<pacman::EntityRegistry> registry,
+                   std::weak_ptr<pacman::Camera> camera)  // & niet *
+    : EntityView(model, std::move(registry), camera) {
     setupCircle();
 }
 
@@ -18,16 +19,11 @@ void CoinView::setupCircle() {
     circle.setOrigin(radius, radius);
 }
 
-void CoinView::draw(sf::RenderWindow& window) {
-    if (!coinModel.isCollected()) {
-        auto cam = camera.lock();  // ✅ Lock weak_ptr
-        if (!cam) return;
-
-        auto worldPos = model.getPosition();
-        auto screenPos = cam->worldToScreen(worldPos);
-        circle.setPosition(screenPos.x, screenPos.y);
-        
-        window.draw(circle);
+void CoinView::draw(sf::RenderTarget& target, const FrameTransform& frame) {
+    auto* coin = getModel<pacman::Coin>();
+    if (coin && !coin->isCollected()) {
+        circle.setPosition(frame.toScreen(coin->getPosition()));
+        target.draw(circle);
     }
 }
 
@@ -2,22 +2,8 @@
 
 namespace pacman::representation {
 
-namespace {
-class DummyModel : public pacman::EntityModel {
-public:
-    DummyModel() : EntityModel(pacman::Position(0, 0), 0) {}
-    void update(float) override {}
-};
-
-// fake model om de parent constructor te 'bypassen'
-DummyModel& getDummyModel() {
-    static DummyModel instance;
-    return instance;
-}
-}
-
 DoorView::DoorView(std::weak_ptr<pacman::Camera> camera, const pacman::Position& doorPos)
-    : EntityView(getDummyModel(), camera), doorPosition(doorPos) {  // ✅ Reference naar static
+    : EntityView(camera), doorPosition(doorPos) {
 
     auto cam = camera.lock();
     if (!cam) return;
@@ -28,13 +14,14 @@ DoorView::DoorView(std::weak_ptr<pacman::Camera> camera, const pacman::Position&
     rectangle.setOrigin(size / 2.0f, size / 2.0f);
 }
 
-void DoorView::draw(sf::RenderWindow& window) {
-    auto cam = camera.lock();
-    if (!cam) return;
+bool DoorView::getWorldBounds(float tileSize, pacman::BoundingBox& bounds) const {
+    bounds = pacman::BoundingBox(doorPosition.x - tileSize / 2.0f, doorPosition.y - tileSize / 2.0f, tileSize, tileSize);
+    return true;
+}
 
-    auto screenPos = cam->worldToScreen(doorPosition);
-    rectangle.setPosition(screenPos.x, screenPos.y);
-    window.draw(rectangle);
+void DoorView::draw(sf::RenderTarget& target, const FrameTransform& frame) {
+    rectangle.setPosition(frame.toScreen(doorPosition));
+    target.draw(rectangle);
 }
 
 } // namespace pacman::representation
\ No newline at end of file
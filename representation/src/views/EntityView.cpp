@@ -2,31 +2,46 @@
 
 namespace pacman::representation {
 
-EntityView::EntityView(pacman::EntityModel& model, std::weak_ptr<pacman::Camera> camera)
-    : model(model), camera(camera) {}
+EntityView::EntityView(pacman::EntityModel& model, std::shared_ptr<pacman::EntityRegistry> registry,
+                       std::weak_ptr<pacman::Camera> camera)
+    : registry(std::move(registry)), handle(model.getHandle()), camera(camera) {}
+
+EntityView::EntityView(std::weak_ptr<pacman::Camera> camera)
+    : camera(camera) {}
 
 EntityView::~EntityView() {
-    model.detach(this);
+    if (auto* model = getModel()) {
+        model->detach(this);
+    }
 }
 
-void EntityView::onNotify(const pacman::Event& event) {
-    if (event.type == pacman::EventType::ENTITY_UPDATED) {
-        updateSpritePosition();
-    }
+void EntityView::onNotify(const pacman::Event& /*event*/) {
+    // Positie wordt pas in draw() gezet (FrameTransform van die frame)
+}
+
+bool EntityView::drawBatched(SpriteBatch& /*batch*/, const FrameTransform& /*frame*/) {
+    return false;
 }
 
 void EntityView::update(float deltaTime) {
     // Deprecated
 }
 
-void EntityView::updateSpritePosition() {
-    auto cam = camera.lock();
-    if (!cam) return;
+bool EntityView::getWorldBounds(float tileSize, pacman::BoundingBox& bounds) const {
+    auto* model = getModel();
+    if (!model) return false;
+
+    auto worldPos = model->getPosition();
+    bounds = pacman::BoundingBox(worldPos.x - tileSize / 2.0f, worldPos.y - tileSize / 2.0f, tileSize, tileSize);
+    return true;
+}
+
+void EntityView::placeSprite(const FrameTransform& frame) {
+    auto* model = getModel();
+    if (!model) return;
 
-    auto worldPos = model.getPosition();
-    auto screenPos = cam->worldToScreen(worldPos);
-    
-    sprite.setPosition(screenPos.x, screenPos.y);
+    sprite.setPosition(frame.toScreen(model->getPosition()));
+    sprite.setScale(frame.spriteScale(sprite.getTextureRect()));
 }
 
 } // namespace pacman::representation
\ No newline at end of file
@@ -5,8 +5,9 @@
 
 namespace pacman::representation {
 
-FruitView::FruitView(pacman::Fruit& model, std::weak_ptr<pacman::Camera> camera)  // & niet *
-    : EntityView(model, camera), fruitModel(model) {
+FruitView::FruitView(pacman::Fruit& model, std::shared_ptr<pacman::EntityRegistry> registry,
+                     std::weak_ptr<pacman::Camera> camera)  // & niet *
+    : EntityView(model, std::move(registry), camera) {
     loadSprite();
 }
 
@@ -18,9 +19,6 @@ void FruitView::loadSprite() {
 }
 
 void FruitView::updateSpriteFromTexture() {
-    auto cam = camera.lock();  // ✅ Lock weak_ptr
-    if (!cam) return;
-
     auto& spriteManager = SpriteManager::getInstance();
 
     try {
@@ -29,11 +27,6 @@ void FruitView::updateSpriteFromTexture() {
             sprite.setTextureRect(rect);
 
             sprite.setOrigin(rect.width / 2.0f, rect.height / 2.0f);
-
-            float targetSize = cam->getSpriteSize();  // ✅ Use locked camera
-            float scaleX = targetSize / rect.width;
-            float scaleY = targetSize / rect.height;
-            sprite.setScale(scaleX, scaleY);
         }
     } catch (const std::exception& e) {
         std::cerr << "FruitView: Error loading sprite: " << e.what() << std::endl;
@@ -41,12 +34,14 @@ void FruitView::updateSpriteFromTexture() {
 }
 
 void FruitView::update(float deltaTime) {
-    updateSpritePosition();
+    // Deprecated: positie wordt gezet in draw()
 }
 
-void FruitView::draw(sf::RenderWindow& window) {
-    if (!fruitModel.isCollected()) {
-        window.draw(sprite);
+void FruitView::draw(sf::RenderTarget& target, const FrameTransform& frame) {
+    auto* fruit = getModel<pacman::Fruit>();
+    if (fruit && !fruit->isCollected()) {
+        placeSprite(frame);
+        target.draw(sprite);
     }
 }
 
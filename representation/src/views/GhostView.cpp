@@ -1,17 +1,19 @@
 #include "representation/views/GhostView.h"
 #include "representation/SpriteManager.h"
+#include "representation/views/SpriteNames.h"
 #include <iostream>
 
 namespace pacman::representation {
 
-GhostView::GhostView(pacman::Ghost& model, std::weak_ptr<pacman::Camera> camera, pacman::GhostColor color)  // & niet *
-    : EntityView(model, camera), ghostModel(model), ghostColor(color) {
+GhostView::GhostView(pacman::Ghost& model, std::shared_ptr<pacman::EntityRegistry> registry,
+                     std::weak_ptr<pacman::Camera> camera, pacman::GhostColor color)  // & niet *
+    : EntityView(model, std::move(registry), camera), ghostColor(color) {
 
     auto& spriteManager = SpriteManager::getInstance();
     sprite.setTexture(spriteManager.getTexture());
 
-    lastDirection = ghostModel.getCurrentDirection();
-    lastState = ghostModel.getState();
+    lastDirection = model.getCurrentDirection();
+    lastState = model.getState();
 
     updateAnimation();
 }
@@ -19,10 +21,11 @@ GhostView::GhostView(pacman::Ghost& model, std::weak_ptr<pacman::Camera> camera,
 void GhostView::onNotify(const pacman::Event& event) {
     switch (event.type) {
     case pacman::EventType::ENTITY_UPDATED: {
-        updateSpritePosition();
+        auto* ghost = getModel<pacman::Ghost>();
+        if (!ghost) break;
 
-        pacman::Direction currentDir = ghostModel.getCurrentDirection();
-        pacman::GhostState currentState = ghostModel.getState();
+        pacman::Direction currentDir = ghost->getCurrentDirection();
+        pacman::GhostState currentState = ghost->getState();
 
         if (currentDir != lastDirection || currentState != lastState) {
             updateAnimation();
@@ -30,32 +33,18 @@ void GhostView::onNotify(const pacman::Event& event) {
             lastState = currentState;
         }
 
-        if (ghostModel.isScared()) {
-            float remainingTime = ghostModel.getScaredTimeRemaining();
-
-            // Bepaal flicker interval (exponentieel sneller)
-            float flickerInterval;
-            if (remainingTime > 3.0f) {
-                flickerInterval = 999.0f;  // Geen flicker (stevig blauw)
-            } else if (remainingTime > 2.0f) {
-                flickerInterval = 0.5f;
-            } else if (remainingTime > 1.0f) {
-                flickerInterval = 0.25f;
-            } else if (remainingTime > 0.5f) {
-                flickerInterval = 0.15f;
-            } else {
-                flickerInterval = 0.08f;  // Zeer snel aan einde
-            }
+        if (ghost->isScared()) {
+            float remainingTime = ghost->getScaredTimeRemaining();
 
             flickerTimer += event.deltaTime;
-            if (flickerTimer >= flickerInterval) {
+            if (flickerTimer >= sprites::flickerInterval(remainingTime)) {
                 flickerTimer = 0.0f;
                 flickerState = !flickerState;
             }
 
             updateSpriteFromScared();
         } else {
-            animationController.update(event.deltaTime);
+            animationController.update();
             updateSpriteFromAnimation();
         }
         break;
@@ -73,24 +62,20 @@ void GhostView::onNotify(const pacman::Event& event) {
 }
 
 void GhostView::updateSpriteFromScared() {
-    auto cam = camera.lock();
-    if (!cam) return;
+    // Kies sprite gebaseerd op flicker state
+    int scaredFrame = flickerState ? 1 : 0;
+    if (scaredFrame == appliedScaredFrame) return;
 
     auto& spriteManager = SpriteManager::getInstance();
-
-    // Kies sprite gebaseerd op flicker state
-    std::string spriteName = flickerState ? "ghost_scared_2" : "ghost_scared_1";
+    const std::string& spriteName = sprites::SCARED_SPRITES[scaredFrame];
+    appliedScaredFrame = scaredFrame;
+    appliedFrameVersion = 0;  // Terug naar de animation: opnieuw zetten
 
     try {
         if (spriteManager.hasSpriteRect(spriteName)) {
             sf::IntRect rect = spriteManager.getSpriteRect(spriteName);
             sprite.setTextureRect(rect);
             sprite.setOrigin(rect.width / 2.0f, rect.height / 2.0f);
-
-            float targetSize = cam->getSpriteSize();
-            float scaleX = targetSize / rect.width;
-            float scaleY = targetSize / rect.height;
-            sprite.setScale(scaleX, scaleY);
         }
     } catch (const std::exception& e) {
         std::cerr << "GhostView: Error updating scared sprite: " << e.what() << std::endl;
@@ -98,32 +83,17 @@ void GhostView::updateSpriteFromScared() {
 }
 
 void GhostView::updateAnimation() {
+    auto* ghost = getModel<pacman::Ghost>();
+    if (!ghost) return;
+
     auto& spriteManager = SpriteManager::getInstance();
     std::string animationName;
 
     // Scared heeft voorrang boven kleur
-    if (ghostModel.isScared()) {
-        animationName = "ghost_scared";
+    if (ghost->isScared()) {
+        animationName = sprites::GHOST_SCARED_ANIMATION;
     } else {
-        std::string colorPrefix;
-        switch (ghostColor) {
-        case pacman::GhostColor::RED:    colorPrefix = "ghost_red"; break;
-        case pacman::GhostColor::PINK:   colorPrefix = "ghost_pink"; break;
-        case pacman::GhostColor::BLUE:   colorPrefix = "ghost_cyan"; break;
-        case pacman::GhostColor::ORANGE: colorPrefix = "ghost_orange"; break;
-        }
-
-        pacman::Direction dir = ghostModel.getCurrentDirection();
-        std::string dirSuffix;
-        switch (dir) {
-        case pacman::Direction::UP:    dirSuffix = "_walk_up"; break;
-        case pacman::Direction::DOWN:  dirSuffix = "_walk_down"; break;
-        case pacman::Direction::LEFT:  dirSuffix = "_walk_left"; break;
-        case pacman::Direction::RIGHT: dirSuffix = "_walk_right"; break;
-        default: dirSuffix = "_walk_right"; break;
-        }
-
-        animationName = colorPrefix + dirSuffix;
+        animationName = sprites::ghostWalkAnimation(ghostColor, ghost->getCurrentDirection());
     }
 
     try {
@@ -136,32 +106,37 @@ void GhostView::updateAnimation() {
 }
 
 void GhostView::updateSpriteFromAnimation() {
-    auto cam = camera.lock();  // ✅ Lock weak_ptr
-    if (!cam) return;
+    if (animationController.getFrameVersion() == appliedFrameVersion) return;
 
     auto& spriteManager = SpriteManager::getInstance();
-    std::string spriteName = animationController.getCurrentSpriteName();
+    const std::string& spriteName = animationController.getCurrentSpriteName();
 
     if (spriteName.empty()) return;
+    appliedFrameVersion = animationController.getFrameVersion();
+    appliedScaredFrame = -1;
 
     try {
         if (spriteManager.hasSpriteRect(spriteName)) {
             sf::IntRect rect = spriteManager.getSpriteRect(spriteName);
             sprite.setTextureRect(rect);
             sprite.setOrigin(rect.width / 2.0f, rect.height / 2.0f);
-
-            float targetSize = cam->getSpriteSize();  // ✅ Use locked camera
-            float scaleX = targetSize / rect.width;
-            float scaleY = targetSize / rect.height;
-            sprite.setScale(scaleX, scaleY);
         }
     } catch (const std::exception& e) {
         std::cerr << "GhostView: Error updating sprite: " << e.what() << std::endl;
     }
 }
 
-void GhostView::draw(sf::RenderWindow& window) {
-    window.draw(sprite);
+void GhostView::draw(sf::RenderTarget& target, const FrameTransform& frame) {
+    if (!getModel()) return;
+    placeSprite(frame);
+    target.draw(sprite);
+}
+
+bool GhostView::drawBatched(SpriteBatch& batch, const FrameTransform& frame) {
+    if (!getModel()) return true;  // Niets te tekenen, ook niet via draw()
+    placeSprite(frame);
+    batch.add(sprite);
+    return true;
 }
 
 } // namespace pacman::representation
\ No newline at end of file
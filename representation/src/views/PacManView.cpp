@@ -1,11 +1,13 @@
 #include "representation/views/PacManView.h"
 #include "representation/SpriteManager.h"
+#include "representation/views/SpriteNames.h"
 #include <iostream>
 
 namespace pacman::representation {
 
-PacManView::PacManView(pacman::PacMan& model, std::weak_ptr<pacman::Camera> camera)
-    : EntityView(model, camera), pacmanModel(&model) {
+PacManView::PacManView(pacman::PacMan& model, std::shared_ptr<pacman::EntityRegistry> registry,
+                       std::weak_ptr<pacman::Camera> camera)
+    : EntityView(model, std::move(registry), camera) {
 
     auto& spriteManager = SpriteManager::getInstance();
     sprite.setTexture(spriteManager.getTexture());
@@ -22,7 +24,8 @@ PacManView::PacManView(pacman::PacMan& model, std::weak_ptr<pacman::Camera> came
 void PacManView::onNotify(const pacman::Event& event) {
     switch (event.type) {
     case pacman::EventType::ENTITY_UPDATED: {
-        updateSpritePosition();
+        auto* pacmanModel = getModel<pacman::PacMan>();
+        if (!pacmanModel) break;
 
         if (!playingDeathAnimation) {
             pacman::Direction currentDirection = pacmanModel->getDirection();
@@ -31,10 +34,10 @@ void PacManView::onNotify(const pacman::Event& event) {
                 lastDirection = currentDirection;
             }
 
-            animationController.update(event.deltaTime);
+            animationController.update();
             updateSpriteFromAnimation();
         } else {
-            animationController.update(event.deltaTime);
+            animationController.update();
             updateSpriteFromAnimation();
 
             if (animationController.isFinished()) {
@@ -78,14 +81,8 @@ void PacManView::onNotify(const pacman::Event& event) {
 void PacManView::switchAnimation(pacman::Direction direction) {
     auto& spriteManager = SpriteManager::getInstance();
 
-    std::string animationName;
-    switch (direction) {
-        case pacman::Direction::RIGHT: animationName = "pacman_walk_right"; break;
-        case pacman::Direction::LEFT:  animationName = "pacman_walk_left";  break;
-        case pacman::Direction::UP:    animationName = "pacman_walk_up";    break;
-        case pacman::Direction::DOWN:  animationName = "pacman_walk_down";  break;
-        default: return;
-    }
+    const char* animationName = sprites::pacmanWalkAnimation(direction);
+    if (!animationName) return;
 
     try {
         if (spriteManager.hasAnimation(animationName)) {
@@ -99,24 +96,19 @@ void PacManView::switchAnimation(pacman::Direction direction) {
 }
 
 void PacManView::updateSpriteFromAnimation() {
-    auto cam = camera.lock();  // ✅ Lock weak_ptr
-    if (!cam) return;
+    if (animationController.getFrameVersion() == appliedFrameVersion) return;
 
     auto& spriteManager = SpriteManager::getInstance();
-    std::string spriteName = animationController.getCurrentSpriteName();
+    const std::string& spriteName = animationController.getCurrentSpriteName();
 
     if (spriteName.empty()) return;
+    appliedFrameVersion = animationController.getFrameVersion();
 
     try {
         if (spriteManager.hasSpriteRect(spriteName)) {
             sf::IntRect rect = spriteManager.getSpriteRect(spriteName);
             sprite.setTextureRect(rect);
             sprite.setOrigin(rect.width / 2.0f, rect.height / 2.0f);
-
-            float targetSize = cam->getSpriteSize();  // ✅ Use locked camera
-            float scaleX = targetSize / rect.width;
-            float scaleY = targetSize / rect.height;
-            sprite.setScale(scaleX, scaleY);
         } else {
             std::cerr << "PacManView: Sprite not found: " << spriteName << std::endl;
         }
@@ -125,9 +117,17 @@ void PacManView::updateSpriteFromAnimation() {
     }
 }
 
-void PacManView::draw(sf::RenderWindow& window) {
-    if (!pacmanModel) return;
-    window.draw(sprite);
+void PacManView::draw(sf::RenderTarget& target, const FrameTransform& frame) {
+    if (!getModel()) return;
+    placeSprite(frame);
+    target.draw(sprite);
+}
+
+bool PacManView::drawBatched(SpriteBatch& batch, const FrameTransform& frame) {
+    if (!getModel()) return true;  // Niets te tekenen, ook niet via draw()
+    placeSprite(frame);
+    batch.add(sprite);
+    return true;
 }
 
 } // namespace pacman::representation
\ No newline at end of file
@@ -2,8 +2,9 @@
 
 namespace pacman::representation {
 
-WallView::WallView(pacman::Wall& model, std::weak_ptr<pacman::Camera> camera)  // & niet *
-    : EntityView(model, camera), wallModel(model) {
+WallView::WallView(pacman::Wall& model, std::shared_ptr<pacman::EntityRegistry> registry,
+                   std::weak_ptr<pacman::Camera> camera)  // & niet *
+    : EntityView(model, std::move(registry), camera) {
     setupRectangle();
 }
 
@@ -21,15 +22,12 @@ void WallView::setupRectangle() {
     rectangle.setOrigin(sizeWithOverlap / 2.0f, sizeWithOverlap / 2.0f);
 }
 
-void WallView::draw(sf::RenderWindow& window) {
-    auto cam = camera.lock();  // ✅ Lock weak_ptr
-    if (!cam) return;
+void WallView::draw(sf::RenderTarget& target, const FrameTransform& frame) {
+    auto* wall = getModel();
+    if (!wall) return;
 
-    auto worldPos = model.getPosition();
-    auto screenPos = cam->worldToScreen(worldPos);
-    rectangle.setPosition(screenPos.x, screenPos.y);
-    
-    window.draw(rectangle);
+    rectangle.setPosition(frame.toScreen(wall->getPosition()));
+    target.draw(rectangle);
 }
 
 } // namespace pacman::representation
\ No newline at end of file